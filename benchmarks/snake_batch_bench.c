@@ -0,0 +1,150 @@
+#include <ctype.h>
+#include <errno.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <SDL3/SDL_cpuinfo.h>
+#include <SDL3/SDL_timer.h>
+
+#include "core/snake_batch.h"
+
+/*
+ * Steps the same batch of games at 1, 2, 4, ... threads up to the logical core count and prints ticks per second
+ * for each. Every run starts from the same seed, and its final boards are checked against the single-threaded run.
+ *
+ * Usage: snake_batch_bench [instances] [ticks] [grid_size]
+ */
+
+static const size_t k_default_count = 10000;
+static const int k_default_ticks = 1000;
+static const int k_default_grid_size = 50;
+static const uint64_t k_seed = 1234u;
+
+/* FNV-1a over the boards and lengths, enough to tell whether two runs ended in the same place. */
+static uint64_t hash_batch(const snake_batch_t* batch) {
+    uint64_t hash = 14695981039346656037ull;
+    const size_t cell_count = batch->count * batch->cells_per_instance;
+    for (size_t i = 0; i < cell_count; ++i) {
+        hash = (hash ^ batch->cell_states[i]) * 1099511628211ull;
+    }
+    for (size_t i = 0; i < batch->count; ++i) {
+        hash = (hash ^ batch->lengths[i]) * 1099511628211ull;
+    }
+    return hash;
+}
+
+/* Deterministic per-instance steering so the games do not all run straight into themselves. */
+static void fill_actions(uint8_t* actions, size_t count, int tick) {
+    for (size_t i = 0; i < count; ++i) {
+        const uint32_t mix = (uint32_t)i * 2654435761u ^ (uint32_t)tick * 40503u;
+        actions[i] = (mix >> 7) % 8 < 4 ? (uint8_t)((mix >> 3) % 4) : SNAKE_BATCH_ACTION_KEEP;
+    }
+}
+
+/* Parse a whole decimal argument in [min, max]; signs, trailing text and out-of-range values are rejected. */
+static bool parse_argument(const char* text, unsigned long min, unsigned long max, unsigned long* out_value) {
+    if (isdigit((unsigned char)text[0]) == 0) {
+        return false;
+    }
+
+    char* end;
+    errno = 0;
+    const unsigned long value = strtoul(text, &end, 10);
+    if (*end != '\0' || errno == ERANGE || value < min || value > max) {
+        return false;
+    }
+
+    *out_value = value;
+    return true;
+}
+
+static bool run(int workers, size_t count, int ticks, int grid_size, double* out_seconds, uint64_t* out_hash) {
+    snake_batch_t batch;
+    thread_pool_t pool;
+    snake_batch_init(&batch);
+    thread_pool_init(&pool);
+
+    uint8_t* const actions = malloc(count);
+    if (actions == NULL || snake_batch_create(&batch, count, grid_size, grid_size, k_seed) == false ||
+        thread_pool_create(&pool, workers) == false) {
+        free(actions);
+        snake_batch_destroy(&batch);
+        return false;
+    }
+
+    Uint64 elapsed = 0;
+    for (int tick = 0; tick < ticks; ++tick) {
+        fill_actions(actions, count, tick);
+
+        const Uint64 start = SDL_GetPerformanceCounter();
+        snake_batch_step_parallel(&batch, &pool, actions, NULL, NULL);
+        elapsed += SDL_GetPerformanceCounter() - start;
+    }
+
+    *out_seconds = (double)elapsed / (double)SDL_GetPerformanceFrequency();
+    *out_hash = hash_batch(&batch);
+
+    thread_pool_destroy(&pool);
+    snake_batch_destroy(&batch);
+    free(actions);
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    unsigned long count_value = k_default_count;
+    unsigned long ticks_value = k_default_ticks;
+    unsigned long grid_size_value = k_default_grid_size;
+    if (argc > 4 || (argc > 1 && parse_argument(argv[1], 1, ULONG_MAX, &count_value) == false) ||
+        (argc > 2 && parse_argument(argv[2], 1, INT_MAX, &ticks_value) == false) ||
+        (argc > 3 && parse_argument(argv[3], SNAKE_SIM_GRID_MIN, SNAKE_SIM_GRID_MAX, &grid_size_value) == false)) {
+        fprintf(stderr, "Usage: %s [instances] [ticks] [grid_size]\n", argv[0]);
+        fprintf(stderr, "  instances >= 1, ticks >= 1, grid_size %d..%d\n", SNAKE_SIM_GRID_MIN, SNAKE_SIM_GRID_MAX);
+        return EXIT_FAILURE;
+    }
+
+    const size_t count = (size_t)count_value;
+    const int ticks = (int)ticks_value;
+    const int grid_size = (int)grid_size_value;
+
+    int max_workers = SDL_GetNumLogicalCPUCores();
+    if (max_workers > THREAD_POOL_MAX_WORKERS) {
+        max_workers = THREAD_POOL_MAX_WORKERS;
+    }
+
+    printf("%zu games on %dx%d, %d ticks\n", count, grid_size, grid_size, ticks);
+    printf("%8s %14s %18s %9s\n", "threads", "ticks/s", "instance-steps/s", "speedup");
+
+    double baseline_seconds = 0.0;
+    uint64_t baseline_hash = 0;
+    if (max_workers < 1) {
+        max_workers = 1;
+    }
+
+    // Doubling thread counts, finishing on the core count itself if it is not a power of two.
+    for (int workers = 1;; workers = workers * 2 < max_workers ? workers * 2 : max_workers) {
+        double seconds;
+        uint64_t hash;
+        if (run(workers, count, ticks, grid_size, &seconds, &hash) == false) {
+            fprintf(stderr, "Failed to set up %d thread run\n", workers);
+            return EXIT_FAILURE;
+        }
+
+        if (workers == 1) {
+            baseline_seconds = seconds;
+            baseline_hash = hash;
+        } else if (hash != baseline_hash) {
+            fprintf(stderr, "%d thread run diverged from the single-threaded run\n", workers);
+            return EXIT_FAILURE;
+        }
+
+        printf("%8d %14.0f %18.0f %8.2fx\n", workers, ticks / seconds, (double)count * ticks / seconds,
+               baseline_seconds / seconds);
+
+        if (workers == max_workers) {
+            break;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}
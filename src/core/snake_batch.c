@@ -0,0 +1,209 @@
+#include "snake_batch.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_log.h>
+
+static uint8_t* instance_states(const snake_batch_t* batch, size_t index) {
+    return &batch->cell_states[index * batch->cells_per_instance];
+}
+
+static uint8_t* instance_links(const snake_batch_t* batch, size_t index) {
+    return &batch->cell_links[index * batch->cells_per_instance];
+}
+
+static snake_rules_grid_t instance_grid(snake_batch_t* batch, size_t index) {
+    const snake_rules_grid_t grid = {instance_states(batch, index), &batch->free_cells[index], &batch->rngs[index],
+                                     batch->grid_width, batch->grid_height};
+    return grid;
+}
+
+void snake_batch_init(snake_batch_t* batch) {
+    SDL_assert(batch != NULL);
+
+    memset(batch, 0, sizeof(*batch));
+}
+
+static void release_instances(snake_batch_t* batch) {
+    free(batch->cell_states);
+    free(batch->cell_links);
+    free(batch->heads);
+    free(batch->tails);
+    free(batch->lengths);
+    free(batch->free_cells);
+    free(batch->free_cell_dense);
+    free(batch->free_cell_sparse);
+    free(batch->directions);
+    free(batch->rngs);
+    snake_batch_init(batch);
+}
+
+bool snake_batch_create(snake_batch_t* batch, size_t count, int grid_width, int grid_height, uint64_t seed) {
+    SDL_assert(batch != NULL);
+    SDL_assert(batch->cell_states == NULL);
+
+    if (count == 0 || grid_width < SNAKE_SIM_GRID_MIN || grid_width > SNAKE_SIM_GRID_MAX ||
+        grid_height < SNAKE_SIM_GRID_MIN || grid_height > SNAKE_SIM_GRID_MAX) {
+        SDL_Log("Invalid batch of %zu %dx%d games", count, grid_width, grid_height);
+        return false;
+    }
+
+    const size_t cells_per_instance = (size_t)grid_width * (size_t)grid_height;
+    if (count > SIZE_MAX / cells_per_instance / sizeof(uint32_t)) {
+        SDL_Log("Batch allocation would overflow (count=%zu)", count);
+        return false;
+    }
+
+    batch->cell_states = malloc(count * cells_per_instance);
+    batch->cell_links = calloc(count * cells_per_instance, 1);
+    batch->heads = malloc(count * sizeof(uint32_t));
+    batch->tails = malloc(count * sizeof(uint32_t));
+    batch->lengths = malloc(count * sizeof(uint32_t));
+    batch->free_cells = malloc(count * sizeof(sparse_set_t));
+    batch->free_cell_dense = malloc(count * cells_per_instance * sizeof(uint32_t));
+    batch->free_cell_sparse = calloc(count * cells_per_instance, sizeof(uint32_t));
+    batch->directions = malloc(count * sizeof(uint8_t));
+    batch->rngs = malloc(count * sizeof(rng_t));
+    if (batch->cell_states == NULL || batch->cell_links == NULL || batch->heads == NULL || batch->tails == NULL ||
+        batch->lengths == NULL || batch->free_cells == NULL || batch->free_cell_dense == NULL ||
+        batch->free_cell_sparse == NULL || batch->directions == NULL || batch->rngs == NULL) {
+        SDL_Log("Failed to allocate batch of %zu %dx%d games", count, grid_width, grid_height);
+        release_instances(batch);
+        return false;
+    }
+
+    batch->count = count;
+    batch->grid_width = grid_width;
+    batch->grid_height = grid_height;
+    batch->cells_per_instance = cells_per_instance;
+
+    for (size_t i = 0; i < count; ++i) {
+        const size_t offset = i * cells_per_instance;
+        sparse_set_attach(&batch->free_cells[i], cells_per_instance, &batch->free_cell_dense[offset],
+                          &batch->free_cell_sparse[offset]);
+        rng_seed(&batch->rngs[i], seed + i);
+        snake_batch_reset_instance(batch, i);
+    }
+
+    return true;
+}
+
+void snake_batch_destroy(snake_batch_t* batch) {
+    SDL_assert(batch != NULL);
+    release_instances(batch);
+}
+
+void snake_batch_reset_instance(snake_batch_t* batch, size_t index) {
+    SDL_assert(batch != NULL);
+    SDL_assert(index < batch->count);
+
+    const snake_rules_grid_t grid = instance_grid(batch, index);
+    uint32_t head;
+    uint32_t food[SNAKE_SIM_FOOD_COUNT];
+    int food_count = 0;
+    const bool has_room = snake_rules_start_round(&grid, &head, food, &food_count);
+    SDL_assert(has_room == true);
+    (void)has_room;
+
+    batch->heads[index] = head;
+    batch->tails[index] = head;
+    batch->lengths[index] = 1;
+    batch->directions[index] = SNAKE_DIRECTION_UP;
+}
+
+/**
+ * @brief Advance one instance by one tick.
+ *
+ * @return the reward for the tick; the instance has already been reset when it is SNAKE_BATCH_REWARD_DEATH.
+ */
+static float step_instance(snake_batch_t* batch, size_t index, uint8_t action) {
+    SDL_assert(action <= SNAKE_DIRECTION_RIGHT || action == SNAKE_BATCH_ACTION_KEEP);
+
+    if (action <= SNAKE_DIRECTION_RIGHT &&
+        snake_rules_is_reversal((snake_direction_t)batch->directions[index], (snake_direction_t)action) == false) {
+        batch->directions[index] = action;
+    }
+
+    const snake_rules_grid_t grid = instance_grid(batch, index);
+    const uint32_t head = batch->heads[index];
+    const uint32_t tail = batch->tails[index];
+    const snake_direction_t direction = (snake_direction_t)batch->directions[index];
+    const snake_rules_move_t move = snake_rules_move(&grid, head, tail, batch->lengths[index], direction);
+
+    if (move.event == SNAKE_SIM_EVENT_COLLISION) {
+        snake_batch_reset_instance(batch, index);
+        return SNAKE_BATCH_REWARD_DEATH;
+    }
+
+    uint8_t* const links = instance_links(batch, index);
+    links[head] = (uint8_t)direction;
+    batch->heads[index] = move.head;
+
+    if (move.event == SNAKE_SIM_EVENT_ATE_FOOD) {
+        batch->lengths[index]++;
+        return SNAKE_BATCH_REWARD_FOOD;
+    }
+
+    // The tail follows the body by reading its own cell's link.
+    batch->tails[index] = snake_rules_next_cell(batch->grid_width, batch->grid_height, tail, links[tail]);
+    return 0.0f;
+}
+
+void snake_batch_step(snake_batch_t* batch, const uint8_t* actions, float* out_rewards, uint8_t* out_dones) {
+    SDL_assert(batch != NULL);
+    snake_batch_step_range(batch, 0, batch->count, actions, out_rewards, out_dones);
+}
+
+void snake_batch_step_range(snake_batch_t* batch, size_t begin, size_t end, const uint8_t* actions,
+                            float* out_rewards, uint8_t* out_dones) {
+    SDL_assert(batch != NULL);
+    SDL_assert(begin <= end && end <= batch->count);
+
+    for (size_t i = begin; i < end; ++i) {
+        const uint8_t action = actions != NULL ? actions[i] : SNAKE_BATCH_ACTION_KEEP;
+        const float reward = step_instance(batch, i, action);
+
+        if (out_rewards != NULL) {
+            out_rewards[i] = reward;
+        }
+        if (out_dones != NULL) {
+            out_dones[i] = reward == SNAKE_BATCH_REWARD_DEATH ? 1 : 0;
+        }
+    }
+}
+
+typedef struct {
+    snake_batch_t* batch;
+    const uint8_t* actions;
+    float* out_rewards;
+    uint8_t* out_dones;
+} snake_batch_step_job_t;
+
+static void step_job_range(void* user_data, size_t begin, size_t end) {
+    const snake_batch_step_job_t* const job = (const snake_batch_step_job_t*)user_data;
+    snake_batch_step_range(job->batch, begin, end, job->actions, job->out_rewards, job->out_dones);
+}
+
+void snake_batch_step_parallel(snake_batch_t* batch, thread_pool_t* pool, const uint8_t* actions, float* out_rewards,
+                               uint8_t* out_dones) {
+    SDL_assert(batch != NULL);
+    SDL_assert(pool != NULL);
+
+    snake_batch_step_job_t job = {batch, actions, out_rewards, out_dones};
+    thread_pool_parallel_for(pool, batch->count, SNAKE_BATCH_CHUNK_SIZE, step_job_range, &job);
+}
+
+const uint8_t* snake_batch_get_observation(const snake_batch_t* batch, size_t index) {
+    SDL_assert(batch != NULL);
+    SDL_assert(index < batch->count);
+
+    return instance_states(batch, index);
+}
+
+size_t snake_batch_get_score(const snake_batch_t* batch, size_t index) {
+    SDL_assert(batch != NULL);
+    SDL_assert(index < batch->count);
+
+    return batch->lengths[index] - 1;
+}
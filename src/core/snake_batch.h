@@ -0,0 +1,114 @@
+#ifndef SNAKE_BATCH_H
+#define SNAKE_BATCH_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "snake_sim.h"
+#include "../utils/rng.h"
+#include "../utils/thread_pool.h"
+
+/* Action value that keeps an instance's current direction. Any snake_direction_t value steers instead. */
+#define SNAKE_BATCH_ACTION_KEEP 0xFF
+
+#define SNAKE_BATCH_REWARD_FOOD 1.0f
+#define SNAKE_BATCH_REWARD_DEATH -1.0f
+
+/* Instances per work item in snake_batch_step_parallel(); small enough to balance, large enough to amortize. */
+#define SNAKE_BATCH_CHUNK_SIZE 64
+
+/**
+ * @brief Many independent snake games stepped in lockstep, for bots and training.
+ *
+ * Plays through snake_rules like snake_sim_t, so a batch instance and a snake_sim_t given the same seed and actions
+ * play the same game. Every instance's state is stored structure-of-arrays: each per-instance field is one array
+ * indexed by instance, and all grids share one allocation. Cells are addressed by their row-major index
+ * y * grid_width + x.
+ *
+ * The snake body needs no separate list: every snake cell records in cell_links the direction towards the next
+ * segment (closer to the head), so the tail can follow the body by reading its own cell.
+ */
+typedef struct {
+    size_t count;
+    int grid_width;
+    int grid_height;
+    size_t cells_per_instance;
+
+    /* count * cells_per_instance snake_cell_state_t values, one grid after another. Doubles as the observation. */
+    uint8_t* cell_states;
+    /* Parallel to cell_states; only meaningful for snake cells other than the head. */
+    uint8_t* cell_links;
+
+    uint32_t* heads;
+    uint32_t* tails;
+    /* Number of snake cells including the head; the score is length - 1. */
+    uint32_t* lengths;
+    /* Each instance's empty interior cells, so spawning is an O(1) pick. The sets' arrays are slices of
+     * free_cell_dense and free_cell_sparse, cells_per_instance entries per instance. */
+    sparse_set_t* free_cells;
+    uint32_t* free_cell_dense;
+    uint32_t* free_cell_sparse;
+    uint8_t* directions;
+    rng_t* rngs;
+} snake_batch_t;
+
+/**
+ * @brief Put the batch into a known empty state without allocating.
+ *
+ * Must be called before snake_batch_create() or snake_batch_destroy().
+ */
+void snake_batch_init(snake_batch_t* batch);
+
+/**
+ * @brief Allocate count instances on grids of the given size and start a round on each.
+ *
+ * Instance i draws from its own generator seeded with seed + i, so a batch replays identically from the same seed.
+ *
+ * @return false if the size is out of range or allocation failed.
+ */
+bool snake_batch_create(snake_batch_t* batch, size_t count, int grid_width, int grid_height, uint64_t seed);
+void snake_batch_destroy(snake_batch_t* batch);
+
+/**
+ * @brief Start a fresh round on a single instance, continuing its random sequence.
+ */
+void snake_batch_reset_instance(snake_batch_t* batch, size_t index);
+
+/**
+ * @brief Advance every instance by one tick.
+ *
+ * @param actions count entries, each a snake_direction_t or SNAKE_BATCH_ACTION_KEEP; any other value is invalid.
+ *                A reversal onto the body is ignored, like snake_sim_set_direction(). May be NULL to keep every
+ *                direction.
+ * @param out_rewards Receives SNAKE_BATCH_REWARD_FOOD, SNAKE_BATCH_REWARD_DEATH or 0 per instance. May be NULL.
+ * @param out_dones Receives 1 for instances whose round ended this tick, 0 otherwise. May be NULL. Finished
+ *                  instances are reset straight away, so their observation already shows the next round.
+ */
+void snake_batch_step(snake_batch_t* batch, const uint8_t* actions, float* out_rewards, uint8_t* out_dones);
+
+/**
+ * @brief Advance instances [begin, end) by one tick. Arrays are indexed by instance like snake_batch_step().
+ *
+ * Instances share no state, so disjoint ranges may be stepped concurrently from different threads.
+ */
+void snake_batch_step_range(snake_batch_t* batch, size_t begin, size_t end, const uint8_t* actions,
+                            float* out_rewards, uint8_t* out_dones);
+
+/**
+ * @brief Same as snake_batch_step(), with instances spread over the pool's threads.
+ *
+ * Every instance owns its generator and grid, so the result is bit-identical to snake_batch_step() whatever the
+ * thread count or scheduling.
+ */
+void snake_batch_step_parallel(snake_batch_t* batch, thread_pool_t* pool, const uint8_t* actions, float* out_rewards,
+                               uint8_t* out_dones);
+
+/**
+ * @brief Get the grid of one instance: cells_per_instance snake_cell_state_t values in row-major order.
+ */
+const uint8_t* snake_batch_get_observation(const snake_batch_t* batch, size_t index);
+
+size_t snake_batch_get_score(const snake_batch_t* batch, size_t index);
+
+#endif  // SNAKE_BATCH_H
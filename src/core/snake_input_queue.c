@@ -0,0 +1,65 @@
+#include "snake_input_queue.h"
+
+#include <SDL3/SDL_assert.h>
+
+void snake_input_queue_init(snake_input_queue_t* queue) {
+    SDL_assert(queue != NULL);
+
+    queue->front = 0;
+    queue->count = 0;
+    queue->dropped = 0;
+}
+
+void snake_input_queue_clear(snake_input_queue_t* queue) {
+    snake_input_queue_init(queue);
+}
+
+bool snake_input_queue_push(snake_input_queue_t* queue, snake_direction_t direction, uint64_t timestamp_ns) {
+    SDL_assert(queue != NULL);
+
+    if (queue->count > 0) {
+        const int back = (queue->front + queue->count - 1) % SNAKE_INPUT_QUEUE_CAPACITY;
+        if (queue->entries[back].direction == direction) {
+            return true;
+        }
+    }
+
+    if (queue->count == SNAKE_INPUT_QUEUE_CAPACITY) {
+        queue->dropped++;
+        return false;
+    }
+
+    const int back = (queue->front + queue->count) % SNAKE_INPUT_QUEUE_CAPACITY;
+    queue->entries[back] = (snake_input_t){direction, timestamp_ns};
+    queue->count++;
+    return true;
+}
+
+bool snake_input_queue_apply_next(snake_input_queue_t* queue, snake_sim_t* sim, snake_input_t* out_input) {
+    SDL_assert(queue != NULL);
+    SDL_assert(sim != NULL);
+
+    while (queue->count > 0) {
+        const snake_input_t input = queue->entries[queue->front];
+        queue->front = (queue->front + 1) % SNAKE_INPUT_QUEUE_CAPACITY;
+        queue->count--;
+
+        if (input.direction == sim->current_direction) {
+            continue;
+        }
+        if (snake_sim_set_direction(sim, input.direction) == true) {
+            if (out_input != NULL) {
+                *out_input = input;
+            }
+            return true;
+        }
+    }
+
+    return false;
+}
+
+int snake_input_queue_get_count(const snake_input_queue_t* queue) {
+    SDL_assert(queue != NULL);
+
+    return queue->count;
+}
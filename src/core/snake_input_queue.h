@@ -0,0 +1,70 @@
+#ifndef SNAKE_INPUT_QUEUE_H
+#define SNAKE_INPUT_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "snake_sim.h"
+
+/* Turns held at once. A player rarely gets more than two or three in ahead of the snake; past this, presses are
+ * dropped rather than applied seconds late. */
+#define SNAKE_INPUT_QUEUE_CAPACITY 8
+
+/**
+ * @brief One requested turn and when it was made.
+ */
+typedef struct {
+    snake_direction_t direction;
+    /* When the input happened, in nanoseconds on whatever clock the producer uses (event timestamps for the keyboard,
+     * tick counts or game time for bots and replays). Carried through for latency measurement; never compared. */
+    uint64_t timestamp_ns;
+} snake_input_t;
+
+/**
+ * @brief First-in, first-out queue of turns, of which the simulation takes at most one per tick.
+ *
+ * Writing the direction straight into the simulation loses every turn but the last one made within a tick, and checks
+ * reversals against a direction the snake is not moving in yet. Queued turns are instead applied in order, one per
+ * tick, each checked against the direction the snake actually has by then. Anything that drives a simulation
+ * (keyboard, bots, replays) can feed it the same way.
+ *
+ * Fixed size and allocation-free.
+ */
+typedef struct {
+    snake_input_t entries[SNAKE_INPUT_QUEUE_CAPACITY];
+    int front;
+    int count;
+    /* Inputs refused because the queue was full, since the last snake_input_queue_clear(). */
+    uint32_t dropped;
+} snake_input_queue_t;
+
+void snake_input_queue_init(snake_input_queue_t* queue);
+
+/**
+ * @brief Forget every pending input, e.g. when a new round starts.
+ */
+void snake_input_queue_clear(snake_input_queue_t* queue);
+
+/**
+ * @brief Append a turn.
+ *
+ * A turn the same as the last one queued is a repeat and is not queued again.
+ *
+ * @return false if the queue was full and the input was dropped.
+ */
+bool snake_input_queue_push(snake_input_queue_t* queue, snake_direction_t direction, uint64_t timestamp_ns);
+
+/**
+ * @brief Apply the oldest pending turn that changes the snake's direction, for the tick about to be stepped.
+ *
+ * Turns that would reverse the snake or that it is already going in are discarded on the way, so they never cost a
+ * tick. Call once per snake_sim_step().
+ *
+ * @param out_input Receives the applied turn when one was applied. May be NULL.
+ * @return true if a turn was applied, false if none was pending.
+ */
+bool snake_input_queue_apply_next(snake_input_queue_t* queue, snake_sim_t* sim, snake_input_t* out_input);
+
+int snake_input_queue_get_count(const snake_input_queue_t* queue);
+
+#endif  // SNAKE_INPUT_QUEUE_H
@@ -0,0 +1,137 @@
+#include "snake_latency.h"
+
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+
+static const double k_ns_per_ms = 1000000.0;
+
+static void add_sample(snake_latency_histogram_t* histogram, uint64_t latency_ns) {
+    uint64_t bucket = latency_ns / SNAKE_LATENCY_BUCKET_NS;
+    if (bucket >= SNAKE_LATENCY_BUCKET_COUNT) {
+        bucket = SNAKE_LATENCY_BUCKET_COUNT - 1;
+    }
+    histogram->buckets[bucket]++;
+
+    if (histogram->count == 0 || latency_ns < histogram->min_ns) {
+        histogram->min_ns = latency_ns;
+    }
+    if (latency_ns > histogram->max_ns) {
+        histogram->max_ns = latency_ns;
+    }
+    histogram->count++;
+    histogram->total_ns += latency_ns;
+}
+
+/* Timestamps from different sources can be a little out of order; treat that as no latency rather than wrapping. */
+static uint64_t get_elapsed(uint64_t from_ns, uint64_t to_ns) {
+    return to_ns > from_ns ? to_ns - from_ns : 0;
+}
+
+void snake_latency_init(snake_latency_t* latency) {
+    SDL_assert(latency != NULL);
+
+    memset(latency, 0, sizeof(*latency));
+}
+
+void snake_latency_record_tick(snake_latency_t* latency, uint64_t event_ns, uint64_t tick_ns) {
+    SDL_assert(latency != NULL);
+
+    add_sample(&latency->histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK], get_elapsed(event_ns, tick_ns));
+
+    if (latency->pending_count < SNAKE_LATENCY_MAX_PENDING) {
+        latency->pending[latency->pending_count] = (snake_latency_pending_t){event_ns, tick_ns};
+        latency->pending_count++;
+    }
+}
+
+void snake_latency_record_present(snake_latency_t* latency, uint64_t present_ns) {
+    SDL_assert(latency != NULL);
+
+    for (int i = 0; i < latency->pending_count; ++i) {
+        const snake_latency_pending_t* const pending = &latency->pending[i];
+        add_sample(&latency->histograms[SNAKE_LATENCY_STAGE_TICK_TO_PRESENT],
+                   get_elapsed(pending->tick_ns, present_ns));
+        add_sample(&latency->histograms[SNAKE_LATENCY_STAGE_EVENT_TO_PRESENT],
+                   get_elapsed(pending->event_ns, present_ns));
+    }
+    latency->pending_count = 0;
+}
+
+const char* snake_latency_get_stage_name(snake_latency_stage_t stage) {
+    switch (stage) {
+        case SNAKE_LATENCY_STAGE_EVENT_TO_TICK:
+            return "event_to_tick";
+        case SNAKE_LATENCY_STAGE_TICK_TO_PRESENT:
+            return "tick_to_present";
+        case SNAKE_LATENCY_STAGE_EVENT_TO_PRESENT:
+            return "event_to_present";
+        default:
+            return "unknown";
+    }
+}
+
+uint64_t snake_latency_histogram_get_percentile(const snake_latency_histogram_t* histogram, float percentile) {
+    SDL_assert(histogram != NULL);
+    SDL_assert(percentile >= 0.0f && percentile <= 1.0f);
+
+    if (histogram->count == 0) {
+        return 0;
+    }
+
+    uint64_t rank = (uint64_t)((double)percentile * (double)histogram->count + 0.999999);
+    if (rank == 0) {
+        rank = 1;
+    }
+
+    uint64_t seen = 0;
+    for (int i = 0; i < SNAKE_LATENCY_BUCKET_COUNT - 1; ++i) {
+        seen += histogram->buckets[i];
+        if (seen >= rank) {
+            const uint64_t upper_ns = (uint64_t)(i + 1) * SNAKE_LATENCY_BUCKET_NS;
+            return upper_ns < histogram->max_ns ? upper_ns : histogram->max_ns;
+        }
+    }
+
+    // Only the open-ended last bucket is left, and its upper edge is the largest sample.
+    return histogram->max_ns;
+}
+
+bool snake_latency_write_report(const snake_latency_t* latency, FILE* file) {
+    SDL_assert(latency != NULL);
+    SDL_assert(file != NULL);
+
+    bool success = fprintf(file, "# Input-to-photon latency in milliseconds\n") > 0;
+    success = success && fprintf(file, "%-18s %10s %8s %8s %8s %8s %8s\n", "stage", "samples", "min", "mean", "p50",
+                                 "p99", "max") > 0;
+
+    for (int stage = 0; stage < SNAKE_LATENCY_STAGE_COUNT; ++stage) {
+        const snake_latency_histogram_t* const histogram = &latency->histograms[stage];
+        const double mean_ns = histogram->count > 0 ? (double)histogram->total_ns / (double)histogram->count : 0.0;
+        success = success &&
+                  fprintf(file, "%-18s %10llu %8.2f %8.2f %8.2f %8.2f %8.2f\n",
+                          snake_latency_get_stage_name((snake_latency_stage_t)stage),
+                          (unsigned long long)histogram->count, (double)histogram->min_ns / k_ns_per_ms,
+                          mean_ns / k_ns_per_ms,
+                          (double)snake_latency_histogram_get_percentile(histogram, 0.5f) / k_ns_per_ms,
+                          (double)snake_latency_histogram_get_percentile(histogram, 0.99f) / k_ns_per_ms,
+                          (double)histogram->max_ns / k_ns_per_ms) > 0;
+    }
+
+    // One row per bucket, lower edge first; the last bucket is open-ended.
+    success = success && fprintf(file, "\n%-18s", "bucket") > 0;
+    for (int stage = 0; stage < SNAKE_LATENCY_STAGE_COUNT; ++stage) {
+        success = success && fprintf(file, " %18s", snake_latency_get_stage_name((snake_latency_stage_t)stage)) > 0;
+    }
+    success = success && fprintf(file, "\n") > 0;
+
+    for (int i = 0; i < SNAKE_LATENCY_BUCKET_COUNT; ++i) {
+        const double lower_ms = (double)((uint64_t)i * SNAKE_LATENCY_BUCKET_NS) / k_ns_per_ms;
+        success = success && fprintf(file, "%-18.0f", lower_ms) > 0;
+        for (int stage = 0; stage < SNAKE_LATENCY_STAGE_COUNT; ++stage) {
+            success = success && fprintf(file, " %18u", (unsigned)latency->histograms[stage].buckets[i]) > 0;
+        }
+        success = success && fprintf(file, "\n") > 0;
+    }
+
+    return success;
+}
@@ -0,0 +1,84 @@
+#ifndef SNAKE_LATENCY_H
+#define SNAKE_LATENCY_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+/* Histogram buckets are this wide; the last one also takes everything beyond the others. */
+#define SNAKE_LATENCY_BUCKET_NS 2000000ull
+#define SNAKE_LATENCY_BUCKET_COUNT 50
+
+/* Inputs applied by ticks whose frame has not been presented yet. More than a frame's worth of ticks only happens
+ * while catching up after a stall, and samples past this are not recorded. */
+#define SNAKE_LATENCY_MAX_PENDING 8
+
+typedef enum {
+    /* From the input event to the tick that applied it: time spent waiting in the input queue. */
+    SNAKE_LATENCY_STAGE_EVENT_TO_TICK,
+    /* From that tick to the first present after it: time spent waiting for and drawing a frame. */
+    SNAKE_LATENCY_STAGE_TICK_TO_PRESENT,
+    /* From the input event to the first present that shows its result. */
+    SNAKE_LATENCY_STAGE_EVENT_TO_PRESENT,
+    SNAKE_LATENCY_STAGE_COUNT
+} snake_latency_stage_t;
+
+typedef struct {
+    uint32_t buckets[SNAKE_LATENCY_BUCKET_COUNT];
+    uint64_t count;
+    uint64_t total_ns;
+    uint64_t min_ns;
+    uint64_t max_ns;
+} snake_latency_histogram_t;
+
+typedef struct {
+    uint64_t event_ns;
+    uint64_t tick_ns;
+} snake_latency_pending_t;
+
+/**
+ * @brief Input-to-photon latency, split into the stages an input goes through.
+ *
+ * Fed three timestamps per input, all in nanoseconds on the same clock: the input event itself, the tick that applied
+ * it (snake_latency_record_tick()) and the present that followed (snake_latency_record_present()). The present time is
+ * when presenting returned, not when the display scanned the frame out, so it excludes the compositor and display
+ * latency that come after.
+ *
+ * Fixed size and allocation-free, so recording is cheap enough to stay on in release builds.
+ */
+typedef struct {
+    snake_latency_histogram_t histograms[SNAKE_LATENCY_STAGE_COUNT];
+    snake_latency_pending_t pending[SNAKE_LATENCY_MAX_PENDING];
+    int pending_count;
+} snake_latency_t;
+
+void snake_latency_init(snake_latency_t* latency);
+
+/**
+ * @brief Record that a tick at tick_ns applied an input made at event_ns.
+ */
+void snake_latency_record_tick(snake_latency_t* latency, uint64_t event_ns, uint64_t tick_ns);
+
+/**
+ * @brief Record a present at present_ns, completing every input applied since the previous one.
+ */
+void snake_latency_record_present(snake_latency_t* latency, uint64_t present_ns);
+
+const char* snake_latency_get_stage_name(snake_latency_stage_t stage);
+
+/**
+ * @brief Latency below which the given fraction of samples fall, rounded up to a bucket edge.
+ *
+ * @param percentile Fraction in [0, 1], e.g. 0.99 for the 99th percentile.
+ * @return The latency in nanoseconds, never above the largest sample. 0 if the histogram is empty.
+ */
+uint64_t snake_latency_histogram_get_percentile(const snake_latency_histogram_t* histogram, float percentile);
+
+/**
+ * @brief Write every stage's summary and bucket counts as plain text.
+ *
+ * @return false if writing to the file failed.
+ */
+bool snake_latency_write_report(const snake_latency_t* latency, FILE* file);
+
+#endif  // SNAKE_LATENCY_H
@@ -0,0 +1,135 @@
+#include "snake_rules.h"
+
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+
+SDL_COMPILE_TIME_ASSERT(snake_cell_state_fits_byte, SNAKE_CELL_SNAKE <= 0xFF);
+
+// UP/DOWN and LEFT/RIGHT are adjacent enum values, so the opposite direction only differs in the lowest bit.
+SDL_COMPILE_TIME_ASSERT(snake_direction_up_down_pair, (SNAKE_DIRECTION_UP ^ 1) == SNAKE_DIRECTION_DOWN);
+SDL_COMPILE_TIME_ASSERT(snake_direction_left_right_pair, (SNAKE_DIRECTION_LEFT ^ 1) == SNAKE_DIRECTION_RIGHT);
+
+bool snake_rules_is_reversal(snake_direction_t current, snake_direction_t requested) {
+    return ((unsigned)current ^ 1u) == (unsigned)requested;
+}
+
+uint32_t snake_rules_next_cell(int grid_width, int grid_height, uint32_t cell, snake_direction_t direction) {
+    int x = (int)(cell % (uint32_t)grid_width);
+    int y = (int)(cell / (uint32_t)grid_width);
+
+    switch (direction) {
+        case SNAKE_DIRECTION_UP:
+            y = y == 1 ? grid_height - 2 : y - 1;
+            break;
+        case SNAKE_DIRECTION_DOWN:
+            y = y == grid_height - 2 ? 1 : y + 1;
+            break;
+        case SNAKE_DIRECTION_LEFT:
+            x = x == 1 ? grid_width - 2 : x - 1;
+            break;
+        case SNAKE_DIRECTION_RIGHT:
+            x = x == grid_width - 2 ? 1 : x + 1;
+            break;
+        default:
+            SDL_assert(false);
+            break;
+    }
+
+    return (uint32_t)(y * grid_width + x);
+}
+
+void snake_rules_set_cell(const snake_rules_grid_t* grid, uint32_t cell, snake_cell_state_t state) {
+    SDL_assert(grid != NULL);
+
+    const snake_cell_state_t previous_state = (snake_cell_state_t)grid->cell_states[cell];
+    if (previous_state == SNAKE_CELL_EMPTY && state != SNAKE_CELL_EMPTY) {
+        sparse_set_remove(grid->free_cells, cell);
+    } else if (previous_state != SNAKE_CELL_EMPTY && state == SNAKE_CELL_EMPTY) {
+        sparse_set_insert(grid->free_cells, cell);
+    }
+
+    grid->cell_states[cell] = (uint8_t)state;
+}
+
+bool snake_rules_pick_free_cell(const snake_rules_grid_t* grid, uint32_t* out_cell) {
+    SDL_assert(grid != NULL);
+    SDL_assert(out_cell != NULL);
+
+    if (grid->free_cells->size == 0) {
+        return false;
+    }
+
+    const uint32_t pick = rng_next_bounded(grid->rng, (uint32_t)grid->free_cells->size);
+    *out_cell = sparse_set_get(grid->free_cells, pick);
+    return true;
+}
+
+void snake_rules_sync_free_cells(const snake_rules_grid_t* grid) {
+    SDL_assert(grid != NULL);
+
+    // Walk the interior in memory order, so a fresh board always lists its free cells the same way.
+    sparse_set_clear(grid->free_cells);
+    for (int y = 1; y < grid->grid_height - 1; ++y) {
+        const uint32_t row = (uint32_t)(y * grid->grid_width);
+        for (int x = 1; x < grid->grid_width - 1; ++x) {
+            if (grid->cell_states[row + (uint32_t)x] == SNAKE_CELL_EMPTY) {
+                sparse_set_insert(grid->free_cells, row + (uint32_t)x);
+            }
+        }
+    }
+}
+
+bool snake_rules_start_round(const snake_rules_grid_t* grid, uint32_t* out_head,
+                             uint32_t out_food[SNAKE_SIM_FOOD_COUNT], int* out_food_count) {
+    SDL_assert(grid != NULL);
+    SDL_assert(out_head != NULL);
+    SDL_assert(out_food != NULL);
+    SDL_assert(out_food_count != NULL);
+
+    *out_food_count = 0;
+    memset(grid->cell_states, SNAKE_CELL_EMPTY, (size_t)grid->grid_width * (size_t)grid->grid_height);
+    snake_rules_sync_free_cells(grid);
+
+    if (snake_rules_pick_free_cell(grid, out_head) == false) {
+        return false;
+    }
+    snake_rules_set_cell(grid, *out_head, SNAKE_CELL_SNAKE);
+
+    while (*out_food_count < SNAKE_SIM_FOOD_COUNT &&
+           snake_rules_pick_free_cell(grid, &out_food[*out_food_count]) == true) {
+        snake_rules_set_cell(grid, out_food[*out_food_count], SNAKE_CELL_FOOD);
+        (*out_food_count)++;
+    }
+
+    return true;
+}
+
+snake_rules_move_t snake_rules_move(const snake_rules_grid_t* grid, uint32_t head, uint32_t tail, size_t length,
+                                    snake_direction_t direction) {
+    SDL_assert(grid != NULL);
+    SDL_assert(length >= 1);
+
+    snake_rules_move_t move = {SNAKE_SIM_EVENT_NONE, head, SNAKE_RULES_NO_CELL, SNAKE_RULES_NO_CELL};
+    const uint32_t next = snake_rules_next_cell(grid->grid_width, grid->grid_height, head, direction);
+    const snake_cell_state_t next_state = (snake_cell_state_t)grid->cell_states[next];
+
+    if (next_state == SNAKE_CELL_SNAKE && (length == 1 || next != tail)) {
+        move.event = SNAKE_SIM_EVENT_COLLISION;
+        return move;
+    }
+
+    if (next_state == SNAKE_CELL_FOOD) {
+        move.event = SNAKE_SIM_EVENT_ATE_FOOD;
+        // The eaten cell is not free, so the replacement cannot land under the head.
+        if (snake_rules_pick_free_cell(grid, &move.food) == true) {
+            snake_rules_set_cell(grid, move.food, SNAKE_CELL_FOOD);
+        }
+    } else {
+        move.vacated = tail;
+        snake_rules_set_cell(grid, tail, SNAKE_CELL_EMPTY);
+    }
+
+    move.head = next;
+    snake_rules_set_cell(grid, next, SNAKE_CELL_SNAKE);
+    return move;
+}
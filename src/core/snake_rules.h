@@ -0,0 +1,115 @@
+#ifndef SNAKE_RULES_H
+#define SNAKE_RULES_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../utils/rng.h"
+#include "../utils/sparse_set.h"
+
+#define SNAKE_SIM_FOOD_COUNT 8
+
+/* A cell that does not exist, e.g. the food spawned by a move that ate nothing. */
+#define SNAKE_RULES_NO_CELL UINT32_MAX
+
+typedef enum {
+    SNAKE_DIRECTION_UP,
+    SNAKE_DIRECTION_DOWN,
+    SNAKE_DIRECTION_LEFT,
+    SNAKE_DIRECTION_RIGHT
+} snake_direction_t;
+
+typedef enum { SNAKE_CELL_EMPTY, SNAKE_CELL_WALL, SNAKE_CELL_FOOD, SNAKE_CELL_SNAKE } snake_cell_state_t;
+
+/**
+ * @brief Outcome of a single simulation tick.
+ */
+typedef enum {
+    SNAKE_SIM_EVENT_NONE,
+    SNAKE_SIM_EVENT_ATE_FOOD,
+    SNAKE_SIM_EVENT_COLLISION
+} snake_sim_event_t;
+
+/**
+ * @brief One game's board as the rules see it, borrowed from whoever owns the game.
+ *
+ * snake_sim_t and snake_batch_t store their games differently but both play through these functions, so moving,
+ * growing and spawning follow the same rules and draw the same random numbers in both.
+ *
+ * Cells are row-major indices y * grid_width + x. The outer ring is the wrap-around border and is never played on.
+ */
+typedef struct {
+    /* grid_width * grid_height snake_cell_state_t values. */
+    uint8_t* cell_states;
+    /* The empty interior cells, with a universe of at least grid_width * grid_height. */
+    sparse_set_t* free_cells;
+    rng_t* rng;
+    int grid_width;
+    int grid_height;
+} snake_rules_grid_t;
+
+/**
+ * @brief What one move did to the board.
+ */
+typedef struct {
+    snake_sim_event_t event;
+    /* Cell the head moved to; the old head when the move was a collision. */
+    uint32_t head;
+    /* Cell the tail left, or SNAKE_RULES_NO_CELL when the snake grew or collided. */
+    uint32_t vacated;
+    /* Food spawned in place of the one eaten, or SNAKE_RULES_NO_CELL if none was eaten or the board is full. */
+    uint32_t food;
+} snake_rules_move_t;
+
+/**
+ * @brief Check whether requested points straight back the way current goes.
+ */
+bool snake_rules_is_reversal(snake_direction_t current, snake_direction_t requested);
+
+/**
+ * @brief Get the interior cell one step from cell in direction, wrapping across the border.
+ */
+uint32_t snake_rules_next_cell(int grid_width, int grid_height, uint32_t cell, snake_direction_t direction);
+
+/**
+ * @brief Set a cell's state, keeping free_cells in sync.
+ */
+void snake_rules_set_cell(const snake_rules_grid_t* grid, uint32_t cell, snake_cell_state_t state);
+
+/**
+ * @brief Draw a uniformly random empty interior cell in O(1).
+ *
+ * @return false if the board is full.
+ */
+bool snake_rules_pick_free_cell(const snake_rules_grid_t* grid, uint32_t* out_cell);
+
+/**
+ * @brief Mark every interior cell that is empty in cell_states as free, e.g. after writing cell_states directly.
+ */
+void snake_rules_sync_free_cells(const snake_rules_grid_t* grid);
+
+/**
+ * @brief Clear the board and start a round: the head on a random cell, then up to SNAKE_SIM_FOOD_COUNT food items.
+ *
+ * @param out_food Receives the food cells, in the order they were spawned.
+ * @param out_food_count Receives how many food items fitted on the board.
+ * @return false if there was no room for the head.
+ */
+bool snake_rules_start_round(const snake_rules_grid_t* grid, uint32_t* out_head,
+                             uint32_t out_food[SNAKE_SIM_FOOD_COUNT], int* out_food_count);
+
+/**
+ * @brief Move the snake one cell in direction and update the board.
+ *
+ * Running into the body is a collision that leaves the board untouched, except for the tail cell, which the same
+ * move vacates (a growing snake is always moving onto food). Moving onto food grows the snake: the tail stays and a
+ * replacement is spawned. Otherwise the tail cell is emptied. The caller moves its own record of the body to match.
+ *
+ * @param tail Cell of the last segment; the head itself for a snake of length 1.
+ * @param length Snake cells including the head.
+ */
+snake_rules_move_t snake_rules_move(const snake_rules_grid_t* grid, uint32_t head, uint32_t tail, size_t length,
+                                    snake_direction_t direction);
+
+#endif  // SNAKE_RULES_H
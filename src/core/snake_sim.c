@@ -0,0 +1,492 @@
+#include "snake_sim.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_log.h>
+
+/* Board colors per state. Empty cells are left transparent so reset can clear the color plane with memset. */
+static const SDL_Color k_color_empty = {0, 0, 0, 0};
+static const SDL_Color k_color_food = {255, 0, 0, 255};
+static const SDL_Color k_color_snake = {0, 255, 0, 255};
+
+static uint32_t cell_index(const snake_sim_t* sim, const vector2i_t* position) {
+    return (uint32_t)(position->y * sim->grid_width + position->x);
+}
+
+static vector2i_t cell_position(const snake_sim_t* sim, uint32_t index) {
+    const vector2i_t position = {(int)(index % (uint32_t)sim->grid_width), (int)(index / (uint32_t)sim->grid_width)};
+    return position;
+}
+
+static bool cell_is_interior(const snake_sim_t* sim, const vector2i_t* position) {
+    return position->x > 0 && position->x < sim->grid_width - 1 && position->y > 0 &&
+           position->y < sim->grid_height - 1;
+}
+
+static snake_rules_grid_t get_rules_grid(snake_sim_t* sim) {
+    const snake_rules_grid_t grid = {sim->cell_states, &sim->free_cells, &sim->rng, sim->grid_width, sim->grid_height};
+    return grid;
+}
+
+/**
+ * @brief Give a cell whose state the rules just changed its board color and mark it for redraw.
+ */
+static void paint_cell(snake_sim_t* sim, uint32_t index, const SDL_Color* color) {
+    SDL_assert(sim != NULL);
+    SDL_assert(color != NULL);
+
+    const vector2i_t position = cell_position(sim, index);
+    SDL_assert(cell_is_interior(sim, &position) == true);
+    (void)position;
+
+    if (sim->cell_colors == NULL) {
+        return;
+    }
+
+    sim->cell_colors[index] = *color;
+
+    // Losing track of a change would leave a stale cell on screen, so fall back to a full redraw instead.
+    if (sim->dirty_all == false && dynamic_array_append(&sim->dirty_cells, &index) == false) {
+        sim->dirty_all = true;
+    }
+}
+
+/**
+ * @brief Slide the body forward by one cell in O(1), after snake_rules_move() has updated the grid.
+ *
+ * The old head becomes the front of the body and, unless the snake is growing, the tail is popped off the back.
+ * Segments in between never move.
+ */
+static bool move_head_and_body(snake_sim_t* sim, const vector2i_t* new_head_position, bool grow) {
+    SDL_assert(sim != NULL);
+    SDL_assert(new_head_position != NULL);
+
+    // Save the previous head position.
+    sim->previous_position_head = sim->position_head;
+
+    if (grow == true) {
+        if (ring_buffer_push_front(&sim->array_body, &sim->previous_position_head) == false) {
+            SDL_Log("Failed to grow snake body");
+            return false;
+        }
+        sim->previous_position_tail = *(const vector2i_t*)ring_buffer_back(&sim->array_body);
+    } else {
+        if (ring_buffer_is_empty(&sim->array_body) == true) {
+            // Snake has no array_body, so the previous head position is what gets vacated.
+            sim->previous_position_tail = sim->previous_position_head;
+        } else {
+            // Pop before pushing so a plain move never needs to reallocate.
+            ring_buffer_pop_back(&sim->array_body, &sim->previous_position_tail);
+            (void)ring_buffer_push_front(&sim->array_body, &sim->previous_position_head);
+        }
+        paint_cell(sim, cell_index(sim, &sim->previous_position_tail), &k_color_empty);
+    }
+
+    // Move the snake's head.
+    sim->position_head = *new_head_position;
+    paint_cell(sim, cell_index(sim, &sim->position_head), &k_color_snake);
+
+    return true;
+}
+
+/**
+ * @brief Rebuild the per-segment color lookup table when the snake's length has changed.
+ *
+ * A segment's shade depends only on its index and the current length, so the table stays valid while the snake
+ * slides around and only needs recomputing when it grows or restarts.
+ */
+static bool update_snake_gradient(snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+
+    const Uint8 head_green = 255;
+    const Uint8 tail_green = 120;
+    const float knee = 0.3f;
+    const float knee_weight = 0.7f;
+
+    // Colors only exist for rendering; headless simulations skip the gradient entirely.
+    if (sim->cell_colors == NULL) {
+        return true;
+    }
+
+    const size_t segment_count = sim->array_body.size + 1;
+    if (sim->segment_colors.size == segment_count) {
+        return true;
+    }
+
+    dynamic_array_clear(&sim->segment_colors);
+
+    const SDL_Color head_color = {0, head_green, 0, 255};
+    if (dynamic_array_append(&sim->segment_colors, &head_color) == false) {
+        SDL_Log("Failed to store snake gradient");
+        return false;
+    }
+
+    const float start = (float)head_green;
+    const float end = (float)tail_green;
+    const float length = (float)sim->array_body.size;
+
+    for (size_t i = 0; i < sim->array_body.size; ++i) {
+        const float t = (float)(i + 1) / length;
+        float eased_t;
+        if (t <= knee) {
+            eased_t = (t / knee) * knee_weight;
+        } else {
+            eased_t = knee_weight + ((t - knee) / (1.0f - knee)) * (1.0f - knee_weight);
+        }
+
+        float green_value = start + (end - start) * eased_t;
+        if (green_value < 0.f) {
+            green_value = 0.f;
+        } else if (green_value > 255.f) {
+            green_value = 255.f;
+        }
+
+        const SDL_Color color = {0, (Uint8)(green_value + 0.5f), 0, 255};
+        if (dynamic_array_append(&sim->segment_colors, &color) == false) {
+            SDL_Log("Failed to store snake gradient");
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Swap the eaten food item for the one snake_rules_move() spawned in its place.
+ *
+ * @param spawned Cell of the new food item, or SNAKE_RULES_NO_CELL if the board had no room left.
+ * @return false if the replacement food could not be stored.
+ */
+static bool replace_food(snake_sim_t* sim, const vector2i_t* eaten, uint32_t spawned) {
+    SDL_assert(sim != NULL);
+    SDL_assert(eaten != NULL);
+
+    for (size_t i = 0; i < sim->array_food.size; ++i) {
+        const vector2i_t* const food_position = (const vector2i_t* const)dynamic_array_get(&sim->array_food, i);
+        if (vector2i_equals(eaten, food_position) == true) {
+            dynamic_array_remove(&sim->array_food, i);
+            break;
+        }
+    }
+
+    if (spawned == SNAKE_RULES_NO_CELL) {
+        return true;
+    }
+
+    const vector2i_t new_food_position = cell_position(sim, spawned);
+    if (dynamic_array_append(&sim->array_food, &new_food_position) == false) {
+        SDL_Log("Failed to append replacement food item");
+        return false;
+    }
+    paint_cell(sim, spawned, &k_color_food);
+    return true;
+}
+
+void snake_sim_init(snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+
+    memset(sim, 0, sizeof(*sim));
+
+    sim->current_direction = SNAKE_DIRECTION_UP;
+    dynamic_array_init(&sim->array_food);
+    ring_buffer_init(&sim->array_body);
+    sparse_set_init(&sim->free_cells);
+    dynamic_array_init(&sim->segment_colors);
+    dynamic_array_init(&sim->dirty_cells);
+    rng_seed(&sim->rng, 0);
+}
+
+void snake_sim_seed(snake_sim_t* sim, uint64_t seed) {
+    SDL_assert(sim != NULL);
+    rng_seed(&sim->rng, seed);
+}
+
+static void release_grid(snake_sim_t* sim) {
+    free(sim->cell_states);
+    free(sim->cell_colors);
+    sim->cell_states = NULL;
+    sim->cell_colors = NULL;
+    dynamic_array_destroy(&sim->segment_colors);
+    dynamic_array_destroy(&sim->dirty_cells);
+    sim->dirty_all = false;
+    sparse_set_destroy(&sim->free_cells);
+    sim->grid_width = 0;
+    sim->grid_height = 0;
+}
+
+bool snake_sim_create(snake_sim_t* sim, int grid_width, int grid_height, bool with_color_plane) {
+    SDL_assert(sim != NULL);
+
+    if (grid_width < SNAKE_SIM_GRID_MIN || grid_width > SNAKE_SIM_GRID_MAX || grid_height < SNAKE_SIM_GRID_MIN ||
+        grid_height > SNAKE_SIM_GRID_MAX) {
+        SDL_Log("Invalid grid size %dx%d (expected %d..%d per side)", grid_width, grid_height, SNAKE_SIM_GRID_MIN,
+                SNAKE_SIM_GRID_MAX);
+        return false;
+    }
+
+    release_grid(sim);
+    sim->is_alive = false;
+
+    const size_t cell_count = (size_t)grid_width * (size_t)grid_height;
+    sim->cell_states = calloc(cell_count, sizeof(Uint8));
+    if (with_color_plane == true) {
+        sim->cell_colors = calloc(cell_count, sizeof(SDL_Color));
+    }
+    if (sim->cell_states == NULL || (with_color_plane == true && sim->cell_colors == NULL)) {
+        SDL_Log("Failed to allocate %dx%d grid", grid_width, grid_height);
+        release_grid(sim);
+        return false;
+    }
+
+    if (with_color_plane == true && dynamic_array_create(&sim->segment_colors, sizeof(SDL_Color), 8) == false) {
+        SDL_Log("Failed to allocate snake gradient");
+        release_grid(sim);
+        return false;
+    }
+
+    // A tick changes at most the new head, the vacated tail and a respawned food cell.
+    if (with_color_plane == true && dynamic_array_create(&sim->dirty_cells, sizeof(uint32_t), 16) == false) {
+        SDL_Log("Failed to allocate dirty cell list");
+        release_grid(sim);
+        return false;
+    }
+
+    if (sparse_set_create(&sim->free_cells, cell_count) == false) {
+        SDL_Log("Failed to allocate free cell index");
+        release_grid(sim);
+        return false;
+    }
+
+    sim->grid_width = grid_width;
+    sim->grid_height = grid_height;
+    sim->dirty_all = true;
+    return true;
+}
+
+void snake_sim_destroy(snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+
+    vector2i_set(&sim->position_head, 0, 0);
+    vector2i_set(&sim->previous_position_head, 0, 0);
+    vector2i_set(&sim->previous_position_tail, 0, 0);
+
+    sim->current_direction = SNAKE_DIRECTION_UP;
+    sim->is_alive = false;
+
+    dynamic_array_destroy(&sim->array_food);
+    ring_buffer_destroy(&sim->array_body);
+    release_grid(sim);
+}
+
+bool snake_sim_reset(snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+    SDL_assert(sim->cell_states != NULL);
+
+    sim->is_alive = false;
+
+    /* Re-use the existing allocation when possible (avoids free+malloc on restart). */
+    const bool food_reused = (sim->array_food.data != NULL);
+    const bool body_reused = (sim->array_body.data != NULL);
+    if (food_reused) {
+        dynamic_array_clear(&sim->array_food);
+    }
+    if (body_reused) {
+        ring_buffer_clear(&sim->array_body);
+    }
+
+    if (sim->cell_colors != NULL) {
+        const size_t cell_count = (size_t)sim->grid_width * (size_t)sim->grid_height;
+        memset(sim->cell_colors, 0, cell_count * sizeof(SDL_Color));
+        dynamic_array_clear(&sim->dirty_cells);
+        sim->dirty_all = true;
+    }
+
+    const snake_rules_grid_t grid = get_rules_grid(sim);
+    uint32_t head;
+    uint32_t food[SNAKE_SIM_FOOD_COUNT];
+    int food_count = 0;
+    if (snake_rules_start_round(&grid, &head, food, &food_count) == false) {
+        SDL_Log("Failed to find starting position for snake head");
+        return false;
+    }
+
+    sim->position_head = cell_position(sim, head);
+    paint_cell(sim, head, &k_color_snake);
+    sim->previous_position_head = sim->position_head;
+    sim->previous_position_tail = sim->position_head;
+    sim->current_direction = SNAKE_DIRECTION_UP;
+
+    if (food_reused == false) {
+        if (dynamic_array_create(&sim->array_food, sizeof(vector2i_t), SNAKE_SIM_FOOD_COUNT) == false) {
+            SDL_Log("Failed to allocate food array");
+            return false;
+        }
+    }
+
+    if (food_count < SNAKE_SIM_FOOD_COUNT) {
+        SDL_Log("Warning: Could only spawn %d food items", food_count);
+    }
+    for (int i = 0; i < food_count; ++i) {
+        const vector2i_t food_position = cell_position(sim, food[i]);
+        if (dynamic_array_append(&sim->array_food, &food_position) == false) {
+            SDL_Log("Failed to append food item");
+            if (food_reused == false) {
+                dynamic_array_destroy(&sim->array_food);
+            }
+            return false;
+        }
+        paint_cell(sim, food[i], &k_color_food);
+    }
+
+    if (body_reused == false) {
+        if (ring_buffer_create(&sim->array_body, sizeof(vector2i_t), 8) == false) {
+            SDL_Log("Failed to allocate body array");
+            if (food_reused == false) {
+                dynamic_array_destroy(&sim->array_food);
+            }
+            return false;
+        }
+    }
+
+    // Force the gradient to be rebuilt for the new length.
+    dynamic_array_clear(&sim->segment_colors);
+    if (update_snake_gradient(sim) == false) {
+        return false;
+    }
+
+    sim->is_alive = true;
+    return true;
+}
+
+bool snake_sim_step(snake_sim_t* sim, snake_sim_event_t* out_event) {
+    SDL_assert(sim != NULL);
+    SDL_assert(out_event != NULL);
+
+    *out_event = SNAKE_SIM_EVENT_NONE;
+
+    if (sim->is_alive == false) {
+        return true;
+    }
+
+    const uint32_t head = cell_index(sim, &sim->position_head);
+    uint32_t tail = head;
+    if (ring_buffer_is_empty(&sim->array_body) == false) {
+        tail = cell_index(sim, (const vector2i_t*)ring_buffer_back(&sim->array_body));
+    }
+
+    const snake_rules_grid_t grid = get_rules_grid(sim);
+    const snake_rules_move_t move =
+        snake_rules_move(&grid, head, tail, sim->array_body.size + 1, sim->current_direction);
+    if (move.event == SNAKE_SIM_EVENT_COLLISION) {
+        sim->is_alive = false;
+        *out_event = SNAKE_SIM_EVENT_COLLISION;
+        return true;
+    }
+
+    // Grow the snake if it ate: the tail stays put for this tick.
+    const vector2i_t new_head_position = cell_position(sim, move.head);
+    const bool ate_food = (move.event == SNAKE_SIM_EVENT_ATE_FOOD);
+    if (ate_food == true && replace_food(sim, &new_head_position, move.food) == false) {
+        return false;
+    }
+
+    if (move_head_and_body(sim, &new_head_position, ate_food) == false) {
+        return false;
+    }
+
+    if (ate_food == true) {
+        *out_event = SNAKE_SIM_EVENT_ATE_FOOD;
+    }
+
+    return update_snake_gradient(sim);
+}
+
+bool snake_sim_set_direction(snake_sim_t* sim, snake_direction_t direction) {
+    SDL_assert(sim != NULL);
+
+    if (snake_rules_is_reversal(sim->current_direction, direction) == true) {
+        return false;
+    }
+
+    sim->current_direction = direction;
+    return true;
+}
+
+size_t snake_sim_get_score(const snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+    return sim->array_body.size;
+}
+
+snake_cell_state_t snake_sim_get_cell_state(const snake_sim_t* sim, int x, int y) {
+    SDL_assert(sim != NULL);
+    SDL_assert(sim->cell_states != NULL);
+    SDL_assert(x >= 0 && x < sim->grid_width);
+    SDL_assert(y >= 0 && y < sim->grid_height);
+
+    return (snake_cell_state_t)sim->cell_states[(size_t)y * (size_t)sim->grid_width + (size_t)x];
+}
+
+SDL_Color snake_sim_get_segment_color(const snake_sim_t* sim, size_t index) {
+    SDL_assert(sim != NULL);
+    SDL_assert(sim->cell_colors != NULL);
+    SDL_assert(index < sim->segment_colors.size);
+
+    return *(const SDL_Color*)dynamic_array_get(&sim->segment_colors, index);
+}
+
+SDL_Color snake_sim_get_cell_color(const snake_sim_t* sim, int x, int y) {
+    SDL_assert(sim != NULL);
+    SDL_assert(sim->cell_colors != NULL);
+    SDL_assert(x >= 0 && x < sim->grid_width);
+    SDL_assert(y >= 0 && y < sim->grid_height);
+
+    return sim->cell_colors[(size_t)y * (size_t)sim->grid_width + (size_t)x];
+}
+
+vector2i_t snake_sim_get_step_delta(const snake_sim_t* sim, const vector2i_t* from, const vector2i_t* to) {
+    SDL_assert(sim != NULL);
+    SDL_assert(from != NULL);
+    SDL_assert(to != NULL);
+    SDL_assert(cell_is_interior(sim, from) == true);
+    SDL_assert(cell_is_interior(sim, to) == true);
+
+    vector2i_t delta;
+    vector2i_subtract(to, from, &delta);
+
+    // Anything longer than one cell went through the border, the opposite way.
+    if (delta.x > 1) {
+        delta.x = -1;
+    } else if (delta.x < -1) {
+        delta.x = 1;
+    }
+
+    if (delta.y > 1) {
+        delta.y = -1;
+    } else if (delta.y < -1) {
+        delta.y = 1;
+    }
+
+    return delta;
+}
+
+const uint32_t* snake_sim_get_dirty_cells(const snake_sim_t* sim, size_t* out_count) {
+    SDL_assert(sim != NULL);
+    SDL_assert(out_count != NULL);
+    SDL_assert(sim->cell_colors != NULL);
+
+    *out_count = sim->dirty_cells.size;
+    return (const uint32_t*)sim->dirty_cells.data;
+}
+
+bool snake_sim_needs_full_redraw(const snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+    return sim->dirty_all;
+}
+
+void snake_sim_clear_dirty(snake_sim_t* sim) {
+    SDL_assert(sim != NULL);
+
+    dynamic_array_clear(&sim->dirty_cells);
+    sim->dirty_all = false;
+}
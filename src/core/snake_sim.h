@@ -0,0 +1,168 @@
+#ifndef SNAKE_SIM_H
+#define SNAKE_SIM_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <SDL3/SDL_pixels.h>
+
+#include "snake_rules.h"
+#include "../utils/vector.h"
+#include "../utils/dynamic_array.h"
+#include "../utils/ring_buffer.h"
+#include "../utils/sparse_set.h"
+#include "../utils/rng.h"
+
+#define SNAKE_SIM_GRID_MIN 16
+#define SNAKE_SIM_GRID_MAX 4096
+#define SNAKE_SIM_GRID_DEFAULT 50
+
+/**
+ * @brief Renderer-free snake simulation state.
+ *
+ * Holds everything needed to advance the game one tick at a time without a window, HUD or audio device, so it can
+ * be driven by the game loop as well as by bots, replays and benchmarks. The board itself is played through
+ * snake_rules; this adds the body and food lists, colors and dirty tracking the game renders from.
+ */
+typedef struct {
+    snake_direction_t current_direction;
+
+    vector2i_t position_head;
+    vector2i_t previous_position_head;
+    vector2i_t previous_position_tail;
+
+    int grid_width;
+    int grid_height;
+
+    /*
+     * The grid is stored as separate row-major planes of grid_width * grid_height entries, indexed by
+     * y * grid_width + x. cell_states holds one snake_cell_state_t per byte; cell_colors holds the flat board color
+     * for each cell's state and is only allocated when the simulation was created with a color plane.
+     */
+    Uint8* cell_states;
+    SDL_Color* cell_colors;
+
+    /* Owned by this instance so runs are reproducible from the seed and instances can step on separate threads. */
+    rng_t rng;
+
+    /* Body gradient indexed by segment (0 is the head), rebuilt only when the length changes. Color plane only. */
+    dynamic_array_t segment_colors;
+
+    /*
+     * Row-major indices of cells whose state changed since the last snake_sim_clear_dirty(), so a renderer can patch
+     * a persistent copy of the board instead of redrawing it. dirty_all means the whole grid must be redrawn (new
+     * grid, new round, or the list could not grow). Color plane only; may hold duplicates.
+     */
+    dynamic_array_t dirty_cells;
+    bool dirty_all;
+
+    /* Indices of the empty interior cells, kept in sync with the grid so spawning is an O(1) pick. */
+    sparse_set_t free_cells;
+
+    dynamic_array_t array_food;
+
+    /* Segments behind the head, front (index 0) is the neck and back is the tail. */
+    ring_buffer_t array_body;
+
+    bool is_alive;
+} snake_sim_t;
+
+/**
+ * @brief Put the simulation into a known empty state without allocating.
+ *
+ * Must be called before snake_sim_create() or snake_sim_destroy().
+ */
+void snake_sim_init(snake_sim_t* sim);
+
+/**
+ * @brief Restart the simulation's random sequence from seed.
+ *
+ * Spawning (in snake_sim_reset() and when food is eaten) draws only from this sequence, so the same seed, grid size
+ * and inputs always replay the same game.
+ */
+void snake_sim_seed(snake_sim_t* sim, uint64_t seed);
+
+/**
+ * @brief Allocate a grid of the given size, releasing any grid the simulation already had.
+ *
+ * Both dimensions must lie in [SNAKE_SIM_GRID_MIN, SNAKE_SIM_GRID_MAX]. The outer ring of cells is a wrap-around
+ * border, so the playable area is (grid_width - 2) x (grid_height - 2). Call snake_sim_reset() afterwards to start a
+ * round on the new grid.
+ *
+ * @param with_color_plane Also track render colors (a per-cell board color and the body gradient). Headless users can
+ *                         skip it to save memory and time.
+ * @return false if a dimension is out of range or allocation failed.
+ */
+bool snake_sim_create(snake_sim_t* sim, int grid_width, int grid_height, bool with_color_plane);
+void snake_sim_destroy(snake_sim_t* sim);
+
+/**
+ * @brief Start a new round: clear the grid, place the head and spawn food.
+ *
+ * Requires a grid allocated by snake_sim_create().
+ *
+ * Re-uses the existing food/body allocations when possible.
+ *
+ * @return true on success, false if allocation failed or no free cell was found for the head.
+ */
+bool snake_sim_reset(snake_sim_t* sim);
+
+/**
+ * @brief Advance the simulation by one tick.
+ *
+ * @param sim Simulation to advance. Stepping a dead simulation is a no-op, and a tick that ends in a collision leaves
+ *            the snake where it was.
+ * @param out_event Receives what happened during the tick.
+ * @return false on an unrecoverable error (allocation failure), true otherwise.
+ */
+bool snake_sim_step(snake_sim_t* sim, snake_sim_event_t* out_event);
+
+/**
+ * @brief Request a new movement direction for the next tick.
+ *
+ * @return true if the direction was accepted, false if it would reverse the snake onto itself.
+ */
+bool snake_sim_set_direction(snake_sim_t* sim, snake_direction_t direction);
+
+size_t snake_sim_get_score(const snake_sim_t* sim);
+snake_cell_state_t snake_sim_get_cell_state(const snake_sim_t* sim, int x, int y);
+
+/**
+ * @brief Get the flat board color of a cell. Requires a simulation created with a color plane.
+ */
+SDL_Color snake_sim_get_cell_color(const snake_sim_t* sim, int x, int y);
+
+/**
+ * @brief Get the gradient color of a snake segment. Requires a simulation created with a color plane.
+ *
+ * @param index 0 for the head, i + 1 for array_body element i.
+ */
+SDL_Color snake_sim_get_segment_color(const snake_sim_t* sim, size_t index);
+
+/**
+ * @brief Get the single-cell move that leads from one interior cell to a neighbouring one.
+ *
+ * A move across the wrap-around border jumps the whole width or height of the board in grid coordinates; this
+ * returns the one-cell step the snake actually took, e.g. {-1, 0} from x = 1 to x = grid_width - 2. Used to
+ * interpolate between previous_position_head and position_head.
+ */
+vector2i_t snake_sim_get_step_delta(const snake_sim_t* sim, const vector2i_t* from, const vector2i_t* to);
+
+/**
+ * @brief Get the cells changed since the last snake_sim_clear_dirty(), as row-major indices.
+ *
+ * Only meaningful when snake_sim_needs_full_redraw() returns false. Requires a simulation created with a color plane.
+ */
+const uint32_t* snake_sim_get_dirty_cells(const snake_sim_t* sim, size_t* out_count);
+
+/**
+ * @brief Check whether the whole grid changed since the last snake_sim_clear_dirty().
+ */
+bool snake_sim_needs_full_redraw(const snake_sim_t* sim);
+
+/**
+ * @brief Mark the current grid as seen: empty the dirty list and drop any pending full redraw.
+ */
+void snake_sim_clear_dirty(snake_sim_t* sim);
+
+#endif  // SNAKE_SIM_H
@@ -0,0 +1,42 @@
+#include "snake_speed.h"
+
+#include <SDL3/SDL_assert.h>
+
+void snake_speed_set_defaults(snake_speed_t* speed) {
+    SDL_assert(speed != NULL);
+
+    speed->curve = SNAKE_SPEED_CURVE_CONSTANT;
+    speed->base_rate = SNAKE_SPEED_RATE_DEFAULT;
+    speed->max_rate = SNAKE_SPEED_RATE_DEFAULT;
+    speed->score_step = SNAKE_SPEED_STEP_DEFAULT;
+}
+
+snake_tick_rate_t snake_speed_get_rate(const snake_speed_t* speed, size_t score) {
+    SDL_assert(speed != NULL);
+    SDL_assert(speed->base_rate >= SNAKE_SPEED_RATE_MIN && speed->base_rate <= SNAKE_SPEED_RATE_MAX);
+    SDL_assert(speed->max_rate >= speed->base_rate && speed->max_rate <= SNAKE_SPEED_RATE_MAX);
+    SDL_assert(speed->score_step >= SNAKE_SPEED_STEP_MIN && speed->score_step <= SNAKE_SPEED_STEP_MAX);
+
+    const uint32_t base = (uint32_t)speed->base_rate;
+    const uint32_t step = (uint32_t)speed->score_step;
+    // Past this score every curve has reached max_rate; checking first also keeps the math below from overflowing.
+    const size_t max_score = (size_t)(speed->max_rate - speed->base_rate) * step;
+
+    switch (speed->curve) {
+        case SNAKE_SPEED_CURVE_CONSTANT:
+            return (snake_tick_rate_t){base, 1};
+        case SNAKE_SPEED_CURVE_LINEAR:
+            if (score >= max_score) {
+                return (snake_tick_rate_t){(uint32_t)speed->max_rate, 1};
+            }
+            return (snake_tick_rate_t){base * step + (uint32_t)score, step};
+        case SNAKE_SPEED_CURVE_STEPPED:
+            if (score >= max_score) {
+                return (snake_tick_rate_t){(uint32_t)speed->max_rate, 1};
+            }
+            return (snake_tick_rate_t){base + (uint32_t)score / step, 1};
+    }
+
+    SDL_assert(false && "unknown speed curve");
+    return (snake_tick_rate_t){base, 1};
+}
@@ -0,0 +1,51 @@
+#ifndef SNAKE_SPEED_H
+#define SNAKE_SPEED_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define SNAKE_SPEED_RATE_MIN 1
+#define SNAKE_SPEED_RATE_MAX 240
+#define SNAKE_SPEED_RATE_DEFAULT 8
+
+#define SNAKE_SPEED_STEP_MIN 1
+#define SNAKE_SPEED_STEP_MAX 1000
+#define SNAKE_SPEED_STEP_DEFAULT 5
+
+typedef enum {
+    /* Always base_rate. */
+    SNAKE_SPEED_CURVE_CONSTANT,
+    /* One tick per second faster for every score_step points, gained a fraction with each point. */
+    SNAKE_SPEED_CURVE_LINEAR,
+    /* One tick per second faster once every score_step points. */
+    SNAKE_SPEED_CURVE_STEPPED
+} snake_speed_curve_t;
+
+/**
+ * @brief How often the simulation ticks, as a function of the score.
+ *
+ * The simulation itself has no notion of time; this is what an interactive driver paces snake_sim_step() by. Bots,
+ * replays and benchmarks are free to ignore it and step as fast as they can.
+ */
+typedef struct {
+    snake_speed_curve_t curve;
+    /* Ticks per second at score 0, in [SNAKE_SPEED_RATE_MIN, SNAKE_SPEED_RATE_MAX]. */
+    int base_rate;
+    /* Ticks per second the curve stops at, in [base_rate, SNAKE_SPEED_RATE_MAX]. */
+    int max_rate;
+    /* Points per extra tick per second, in [SNAKE_SPEED_STEP_MIN, SNAKE_SPEED_STEP_MAX]. */
+    int score_step;
+} snake_speed_t;
+
+/**
+ * @brief A tick rate of numerator / denominator ticks per second, kept as a fraction so it is exact.
+ */
+typedef struct {
+    uint32_t numerator;
+    uint32_t denominator;
+} snake_tick_rate_t;
+
+void snake_speed_set_defaults(snake_speed_t* speed);
+snake_tick_rate_t snake_speed_get_rate(const snake_speed_t* speed, size_t score);
+
+#endif  // SNAKE_SPEED_H
@@ -0,0 +1,294 @@
+#include "snake_board.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <SDL3/SDL_log.h>
+
+/* Quads reserved on first use; enough for a fresh round without growing. */
+static const int k_initial_quad_capacity = 256;
+
+/* Above this many dirty cells one upload of the whole plane beats a call per cell. */
+static const size_t k_max_cell_uploads = 64;
+
+enum { k_vertices_per_quad = 4, k_indices_per_quad = 6 };
+
+/* Opaque board background, painted over the part of the head's new cell it has not reached yet. */
+static const SDL_Color k_color_background = {0, 0, 0, 255};
+
+/* Quads drawn besides one per segment: the head's cell cover, a sliding tail and the second half of a wrapping head
+ * and tail. */
+static const int k_extra_quads = 4;
+
+static bool create_texture(snake_board_t* board, SDL_Renderer* renderer, int width, int height) {
+    if (board->texture != NULL) {
+        SDL_DestroyTexture(board->texture);
+        board->texture = NULL;
+    }
+
+    // SDL_Color is laid out as r, g, b, a bytes, which is what RGBA32 means on every platform.
+    board->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA32, SDL_TEXTUREACCESS_STREAMING, width, height);
+    if (board->texture == NULL) {
+        SDL_Log("Failed to create %dx%d board texture: %s", width, height, SDL_GetError());
+        return false;
+    }
+
+    // Cells must stay crisp when stretched, and empty cells (alpha 0 in the color plane) must still paint black.
+    if (SDL_SetTextureScaleMode(board->texture, SDL_SCALEMODE_NEAREST) == false ||
+        SDL_SetTextureBlendMode(board->texture, SDL_BLENDMODE_NONE) == false) {
+        SDL_Log("Failed to configure board texture: %s", SDL_GetError());
+        SDL_DestroyTexture(board->texture);
+        board->texture = NULL;
+        return false;
+    }
+
+    board->texture_width = width;
+    board->texture_height = height;
+    return true;
+}
+
+/**
+ * @brief Upload the cells changed since the last frame, or the whole color plane when the texture is new or most of
+ *        the board changed.
+ */
+static bool update_texture(snake_board_t* board, SDL_Renderer* renderer, snake_sim_t* sim) {
+    bool full_upload = snake_sim_needs_full_redraw(sim);
+    if (board->texture == NULL || board->texture_width != sim->grid_width ||
+        board->texture_height != sim->grid_height) {
+        if (create_texture(board, renderer, sim->grid_width, sim->grid_height) == false) {
+            return false;
+        }
+        full_upload = true;
+    }
+
+    size_t dirty_count = 0;
+    const uint32_t* const dirty_cells = snake_sim_get_dirty_cells(sim, &dirty_count);
+    if (dirty_count > k_max_cell_uploads) {
+        full_upload = true;
+    }
+
+    if (full_upload == true) {
+        if (SDL_UpdateTexture(board->texture, NULL, sim->cell_colors, sim->grid_width * (int)sizeof(SDL_Color)) ==
+            false) {
+            SDL_Log("Failed to upload board texture: %s", SDL_GetError());
+            return false;
+        }
+    } else {
+        for (size_t i = 0; i < dirty_count; ++i) {
+            const uint32_t cell = dirty_cells[i];
+            const SDL_Rect rect = {(int)(cell % (uint32_t)sim->grid_width), (int)(cell / (uint32_t)sim->grid_width), 1,
+                                   1};
+            if (SDL_UpdateTexture(board->texture, &rect, &sim->cell_colors[cell], (int)sizeof(SDL_Color)) == false) {
+                SDL_Log("Failed to update board cell: %s", SDL_GetError());
+                return false;
+            }
+        }
+    }
+
+    snake_sim_clear_dirty(sim);
+    return true;
+}
+
+static bool reserve_quads(snake_board_t* board, int quad_count) {
+    if (quad_count <= board->quad_capacity) {
+        return true;
+    }
+
+    int capacity = board->quad_capacity > 0 ? board->quad_capacity : k_initial_quad_capacity;
+    while (capacity < quad_count) {
+        capacity *= 2;
+    }
+
+    SDL_Vertex* const vertices = realloc(board->vertices, (size_t)capacity * k_vertices_per_quad * sizeof(SDL_Vertex));
+    if (vertices == NULL) {
+        SDL_Log("Failed to grow board vertex buffer to %d quads", capacity);
+        return false;
+    }
+    board->vertices = vertices;
+
+    int* const indices = realloc(board->indices, (size_t)capacity * k_indices_per_quad * sizeof(int));
+    if (indices == NULL) {
+        SDL_Log("Failed to grow board index buffer to %d quads", capacity);
+        return false;
+    }
+    board->indices = indices;
+
+    // Two triangles per quad, corners ordered top-left, top-right, bottom-right, bottom-left.
+    for (int quad = board->quad_capacity; quad < capacity; ++quad) {
+        int* const index = &board->indices[quad * k_indices_per_quad];
+        const int first = quad * k_vertices_per_quad;
+        index[0] = first;
+        index[1] = first + 1;
+        index[2] = first + 2;
+        index[3] = first + 2;
+        index[4] = first + 3;
+        index[5] = first;
+    }
+
+    board->quad_capacity = capacity;
+    return true;
+}
+
+static void push_quad(snake_board_t* board, float x, float y, float width, float height, SDL_Color color) {
+    SDL_assert(board->quad_count < board->quad_capacity);
+
+    const SDL_FColor fcolor = {color.r / 255.0f, color.g / 255.0f, color.b / 255.0f, color.a / 255.0f};
+    SDL_Vertex* const vertex = &board->vertices[board->quad_count * k_vertices_per_quad];
+    vertex[0] = (SDL_Vertex){{x, y}, fcolor, {0.0f, 0.0f}};
+    vertex[1] = (SDL_Vertex){{x + width, y}, fcolor, {0.0f, 0.0f}};
+    vertex[2] = (SDL_Vertex){{x + width, y + height}, fcolor, {0.0f, 0.0f}};
+    vertex[3] = (SDL_Vertex){{x, y + height}, fcolor, {0.0f, 0.0f}};
+    board->quad_count++;
+}
+
+/**
+ * @brief Push one cell-sized quad at a (possibly fractional) cell position inside the board area.
+ */
+static void push_cell(snake_board_t* board, const SDL_FRect* area, const SDL_FPoint* cell_size, float cell_x,
+                      float cell_y, SDL_Color color) {
+    push_quad(board, area->x + cell_x * cell_size->x, area->y + cell_y * cell_size->y, cell_size->x, cell_size->y,
+              color);
+}
+
+/**
+ * @brief Push a cell a fraction t of the way along a one-cell move from one cell to a neighbouring one.
+ *
+ * A move through the wrap-around border leaves at one edge and enters at the opposite one, so both halves are drawn,
+ * each sliding over the border ring on its own side.
+ */
+static void push_moving_cell(snake_board_t* board, const snake_sim_t* sim, const SDL_FRect* area,
+                             const SDL_FPoint* cell_size, const vector2i_t* from, const vector2i_t* to, float t,
+                             SDL_Color color) {
+    const vector2i_t delta = snake_sim_get_step_delta(sim, from, to);
+    push_cell(board, area, cell_size, (float)from->x + (float)delta.x * t, (float)from->y + (float)delta.y * t,
+              color);
+
+    if (from->x + delta.x != to->x || from->y + delta.y != to->y) {
+        push_cell(board, area, cell_size, (float)to->x - (float)delta.x * (1.0f - t),
+                  (float)to->y - (float)delta.y * (1.0f - t), color);
+    }
+}
+
+void snake_board_init(snake_board_t* board) {
+    SDL_assert(board != NULL);
+
+    memset(board, 0, sizeof(*board));
+}
+
+void snake_board_destroy(snake_board_t* board) {
+    SDL_assert(board != NULL);
+
+    snake_board_release_texture(board);
+    free(board->vertices);
+    free(board->indices);
+    snake_board_init(board);
+}
+
+void snake_board_release_texture(snake_board_t* board) {
+    SDL_assert(board != NULL);
+
+    if (board->texture != NULL) {
+        SDL_DestroyTexture(board->texture);
+        board->texture = NULL;
+    }
+    board->texture_width = 0;
+    board->texture_height = 0;
+}
+
+void snake_board_get_area(const snake_sim_t* sim, const vector2i_t* screen_size, SDL_FRect* out_area) {
+    SDL_assert(sim != NULL);
+    SDL_assert(screen_size != NULL);
+    SDL_assert(out_area != NULL);
+
+    float cell_size = SDL_min((float)screen_size->x / (float)sim->grid_width,
+                              (float)screen_size->y / (float)sim->grid_height);
+    if (cell_size >= 1.0f) {
+        // Whole pixels per cell keep every cell the same size; the leftover pixels go to the margins.
+        cell_size = SDL_floorf(cell_size);
+    }
+
+    out_area->w = cell_size * (float)sim->grid_width;
+    out_area->h = cell_size * (float)sim->grid_height;
+    out_area->x = SDL_floorf(((float)screen_size->x - out_area->w) * 0.5f);
+    out_area->y = SDL_floorf(((float)screen_size->y - out_area->h) * 0.5f);
+}
+
+bool snake_board_render(snake_board_t* board, SDL_Renderer* renderer, snake_sim_t* sim, const SDL_FRect* area,
+                        float tick_alpha) {
+    SDL_assert(board != NULL);
+    SDL_assert(renderer != NULL);
+    SDL_assert(sim != NULL);
+    SDL_assert(sim->cell_colors != NULL);
+    SDL_assert(area != NULL);
+    SDL_assert(tick_alpha >= 0.0f && tick_alpha <= 1.0f);
+
+    if (update_texture(board, renderer, sim) == false) {
+        return false;
+    }
+
+    if (SDL_RenderTexture(renderer, board->texture, NULL, area) == false) {
+        SDL_Log("Failed to render board texture: %s", SDL_GetError());
+        return false;
+    }
+
+    const SDL_FPoint cell_size = {area->w / (float)sim->grid_width, area->h / (float)sim->grid_height};
+
+    const int body_size = (int)sim->array_body.size;
+    if (reserve_quads(board, body_size + 1 + k_extra_quads) == false) {
+        return false;
+    }
+
+    board->quad_count = 0;
+    const bool is_moving = tick_alpha < 1.0f;
+
+    if (is_moving == true) {
+        // The texture already shows the head in its new cell, so blank that out for the head to slide into.
+        push_cell(board, area, &cell_size, (float)sim->position_head.x, (float)sim->position_head.y,
+                  k_color_background);
+
+        // The vacated cell is already empty in the texture; draw the tail on its way out of it. A snake that just
+        // grew kept its tail where it was.
+        if (body_size > 0) {
+            const vector2i_t* const tail = (const vector2i_t*)ring_buffer_back(&sim->array_body);
+            if (vector2i_equals(&sim->previous_position_tail, tail) == false) {
+                push_moving_cell(board, sim, area, &cell_size, &sim->previous_position_tail, tail, tick_alpha,
+                                 snake_sim_get_segment_color(sim, (size_t)body_size));
+            }
+        }
+    }
+
+    // Snake segments are shaded by their index along the body, looked up from the sim's gradient table. Tail first so
+    // the sliding head stays on top.
+    for (int i = body_size - 1; i >= 0; --i) {
+        const vector2i_t* const position = (const vector2i_t*)ring_buffer_get(&sim->array_body, (size_t)i);
+        push_cell(board, area, &cell_size, (float)position->x, (float)position->y,
+                  snake_sim_get_segment_color(sim, (size_t)i + 1));
+    }
+
+    if (is_moving == true) {
+        push_moving_cell(board, sim, area, &cell_size, &sim->previous_position_head, &sim->position_head, tick_alpha,
+                         snake_sim_get_segment_color(sim, 0));
+    } else {
+        push_cell(board, area, &cell_size, (float)sim->position_head.x, (float)sim->position_head.y,
+                  snake_sim_get_segment_color(sim, 0));
+    }
+
+    // A cell sliding through the wrap-around border would otherwise spill into the margins around the board.
+    const SDL_Rect clip = {(int)area->x, (int)area->y, (int)SDL_ceilf(area->w), (int)SDL_ceilf(area->h)};
+    if (SDL_SetRenderClipRect(renderer, &clip) == false) {
+        SDL_Log("Failed to clip snake geometry: %s", SDL_GetError());
+        return false;
+    }
+
+    const bool drawn = SDL_RenderGeometry(renderer, NULL, board->vertices, board->quad_count * k_vertices_per_quad,
+                                          board->indices, board->quad_count * k_indices_per_quad);
+    if (drawn == false) {
+        SDL_Log("Failed to render snake geometry: %s", SDL_GetError());
+    }
+
+    if (SDL_SetRenderClipRect(renderer, NULL) == false) {
+        SDL_Log("Failed to reset clip rectangle: %s", SDL_GetError());
+        return false;
+    }
+
+    return drawn;
+}
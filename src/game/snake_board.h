@@ -0,0 +1,68 @@
+#ifndef SNAKE_BOARD_H
+#define SNAKE_BOARD_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_render.h>
+
+#include "../core/snake_sim.h"
+
+/**
+ * @brief GPU-side copy of the board plus the buffers the snake is drawn from, kept across frames.
+ *
+ * The flat board colors (empty, food and snake cells) live in a texture with one texel per cell, scaled up to the board
+ * area with nearest sampling, so the board is drawn at the output's native resolution whatever the window size. Only
+ * the cells the simulation reports as dirty are uploaded each frame, so keeping it current costs in proportion to what
+ * changed rather than to the grid area.
+ *
+ * The body gradient cannot be cached the same way, since every segment takes its neighbour's shade each tick. It is
+ * drawn on top as one coloured quad (four vertices, two triangles) per segment in a single SDL_RenderGeometry() call.
+ * The buffers only grow, and the index buffer follows the same quad pattern for every frame, so it is filled once per
+ * growth rather than per frame.
+ *
+ * Between ticks the head slides from its previous cell into its new one and the tail slides out of the cell it left,
+ * so motion stays smooth at frame rates far above the tick rate. Everything else is drawn where the simulation has it.
+ */
+typedef struct {
+    SDL_Texture* texture;
+    int texture_width;
+    int texture_height;
+
+    SDL_Vertex* vertices;
+    int* indices;
+    int quad_count;
+    int quad_capacity;
+} snake_board_t;
+
+void snake_board_init(snake_board_t* board);
+void snake_board_destroy(snake_board_t* board);
+
+/**
+ * @brief Drop the board texture so the next snake_board_render() recreates and fully uploads it.
+ */
+void snake_board_release_texture(snake_board_t* board);
+
+/**
+ * @brief Work out where the board goes: the largest area with square cells that fits the output, centered.
+ *
+ * Cells are a whole number of pixels whenever the output has room for at least one pixel per cell.
+ *
+ * @param screen_size Output size in pixels.
+ * @param out_area Board area in pixels.
+ */
+void snake_board_get_area(const snake_sim_t* sim, const vector2i_t* screen_size, SDL_FRect* out_area);
+
+/**
+ * @brief Bring the board texture up to date with the simulation, draw it, then draw the snake over it.
+ *
+ * Consumes the simulation's dirty cells (see snake_sim_clear_dirty()), so it must be the only reader of them. The
+ * simulation needs a color plane.
+ *
+ * @param area Where to draw the board, in pixels; see snake_board_get_area().
+ * @param tick_alpha How far the current tick has progressed, in [0, 1]: 0 draws the head and tail where the last tick
+ *                   started, 1 where it ended. Pass 1 whenever the simulation is not advancing.
+ * @return false if the texture or buffers could not be created or the renderer rejected a draw.
+ */
+bool snake_board_render(snake_board_t* board, SDL_Renderer* renderer, snake_sim_t* sim, const SDL_FRect* area,
+                        float tick_alpha);
+
+#endif  // SNAKE_BOARD_H
@@ -4,45 +4,6 @@
 #include <string.h>
 #include <SDL3/SDL_log.h>
 
-static bool create_resume_countdown_text(snake_hud_t* hud, window_t* window, size_t length) {
-    SDL_assert(hud != NULL);
-    SDL_assert(window != NULL);
-
-    if (hud->text_resume_countdown_texture != NULL) {
-        SDL_DestroyTexture(hud->text_resume_countdown_texture);
-        hud->text_resume_countdown_texture = NULL;
-    }
-    hud->text_resume_countdown_size.x = 0;
-    hud->text_resume_countdown_size.y = 0;
-
-    SDL_Surface* surface = TTF_RenderText_Blended(window->ttf_font_default, hud->text_resume_countdown_buffer, length,
-                                                  (SDL_Color){255, 255, 255, 255});
-    if (surface == NULL) {
-        SDL_Log("Failed to render resume countdown surface: %s", SDL_GetError());
-        return false;
-    }
-
-    hud->text_resume_countdown_texture = SDL_CreateTextureFromSurface(window->sdl_renderer, surface);
-    hud->text_resume_countdown_size.x = surface->w;
-    hud->text_resume_countdown_size.y = surface->h;
-    SDL_DestroySurface(surface);
-    if (hud->text_resume_countdown_texture == NULL) {
-        SDL_Log("Failed to create resume countdown texture: %s", SDL_GetError());
-        return false;
-    }
-
-    if (SDL_SetTextureBlendMode(hud->text_resume_countdown_texture, SDL_BLENDMODE_BLEND) == false) {
-        SDL_Log("Failed to set resume countdown texture blend mode: %s", SDL_GetError());
-        SDL_DestroyTexture(hud->text_resume_countdown_texture);
-        hud->text_resume_countdown_texture = NULL;
-        hud->text_resume_countdown_size.x = 0;
-        hud->text_resume_countdown_size.y = 0;
-        return false;
-    }
-
-    return true;
-}
-
 bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config) {
     SDL_assert(hud != NULL);
     SDL_assert(window != NULL);
@@ -53,21 +14,12 @@ bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config)
     hud->menu_fade_start_ms = 0;
     hud->menu_fade_alpha = 0.0f;
 
-    const int written = snprintf(hud->text_score_buffer, sizeof(hud->text_score_buffer), "Score: 0");
-    if (written < 0 || (size_t)written >= sizeof(hud->text_score_buffer)) {
-        SDL_Log("Failed to format initial score text");
+    if (glyph_atlas_create(&hud->glyphs, window->sdl_renderer, window->ttf_font_default) == false) {
+        SDL_Log("Failed to create glyph atlas");
         return false;
     }
 
-    hud->text_score =
-        TTF_CreateText(window->ttf_text_engine, window->ttf_font_default, hud->text_score_buffer, (size_t)written);
-    if (hud->text_score == NULL) {
-        SDL_Log("Failed to create score text object: %s", SDL_GetError());
-        return false;
-    }
-
-    if (TTF_SetTextColor(hud->text_score, 255, 255, 255, 255) == false) {
-        SDL_Log("Failed to set score text color: %s", SDL_GetError());
+    if (snake_hud_update_score(hud, 0) == false) {
         return false;
     }
 
@@ -154,7 +106,7 @@ bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config)
         return false;
     }
 
-    if (snake_hud_update_start_high_score(hud, window, config->high_score) == false) {
+    if (snake_hud_update_start_high_score(hud, config->high_score) == false) {
         return false;
     }
 
@@ -171,25 +123,6 @@ bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config)
         return false;
     }
 
-    const int game_over_written =
-        snprintf(hud->text_game_over_score_buffer, sizeof(hud->text_game_over_score_buffer), "Final Score: 0");
-    if (game_over_written < 0 || (size_t)game_over_written >= sizeof(hud->text_game_over_score_buffer)) {
-        SDL_Log("Failed to format initial game over score text");
-        return false;
-    }
-
-    hud->text_game_over_score = TTF_CreateText(window->ttf_text_engine, window->ttf_font_default,
-                                               hud->text_game_over_score_buffer, (size_t)game_over_written);
-    if (hud->text_game_over_score == NULL) {
-        SDL_Log("Failed to create game over score text object: %s", SDL_GetError());
-        return false;
-    }
-
-    if (TTF_SetTextColor(hud->text_game_over_score, 255, 255, 255, 255) == false) {
-        SDL_Log("Failed to set game over score text color: %s", SDL_GetError());
-        return false;
-    }
-
     if (snake_hud_update_game_over(hud, 0, config->high_score) == false) {
         return false;
     }
@@ -220,14 +153,7 @@ bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config)
         return false;
     }
 
-    const int resume_written =
-        snprintf(hud->text_resume_countdown_buffer, sizeof(hud->text_resume_countdown_buffer), "3");
-    if (resume_written < 0 || (size_t)resume_written >= sizeof(hud->text_resume_countdown_buffer)) {
-        SDL_Log("Failed to format initial resume countdown text");
-        return false;
-    }
-
-    if (create_resume_countdown_text(hud, window, (size_t)resume_written) == false) {
+    if (snake_hud_update_resume_countdown(hud, 3) == false) {
         return false;
     }
 
@@ -296,11 +222,11 @@ bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config)
         return false;
     }
 
-    if (snake_hud_update_options_volume(hud, window, config->volume) == false) {
+    if (snake_hud_update_options_volume(hud, config->volume) == false) {
         return false;
     }
 
-    if (snake_hud_update_options_resume_delay(hud, window, config->resume_delay_seconds) == false) {
+    if (snake_hud_update_options_resume_delay(hud, config->resume_delay_seconds) == false) {
         return false;
     }
 
@@ -310,11 +236,6 @@ bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config)
 void snake_hud_destroy(snake_hud_t* hud) {
     SDL_assert(hud != NULL);
 
-    if (hud->text_score != NULL) {
-        TTF_DestroyText(hud->text_score);
-        hud->text_score = NULL;
-    }
-
     if (hud->text_pause != NULL) {
         TTF_DestroyText(hud->text_pause);
         hud->text_pause = NULL;
@@ -340,11 +261,6 @@ void snake_hud_destroy(snake_hud_t* hud) {
         hud->text_start_button = NULL;
     }
 
-    if (hud->text_start_high_score != NULL) {
-        TTF_DestroyText(hud->text_start_high_score);
-        hud->text_start_high_score = NULL;
-    }
-
     if (hud->text_options_button != NULL) {
         TTF_DestroyText(hud->text_options_button);
         hud->text_options_button = NULL;
@@ -355,11 +271,6 @@ void snake_hud_destroy(snake_hud_t* hud) {
         hud->text_game_over_title = NULL;
     }
 
-    if (hud->text_game_over_score != NULL) {
-        TTF_DestroyText(hud->text_game_over_score);
-        hud->text_game_over_score = NULL;
-    }
-
     if (hud->text_restart_button != NULL) {
         TTF_DestroyText(hud->text_restart_button);
         hud->text_restart_button = NULL;
@@ -370,13 +281,6 @@ void snake_hud_destroy(snake_hud_t* hud) {
         hud->text_resume_title = NULL;
     }
 
-    if (hud->text_resume_countdown_texture != NULL) {
-        SDL_DestroyTexture(hud->text_resume_countdown_texture);
-        hud->text_resume_countdown_texture = NULL;
-    }
-    hud->text_resume_countdown_size.x = 0;
-    hud->text_resume_countdown_size.y = 0;
-
     if (hud->text_options_title != NULL) {
         TTF_DestroyText(hud->text_options_title);
         hud->text_options_title = NULL;
@@ -402,20 +306,11 @@ void snake_hud_destroy(snake_hud_t* hud) {
         hud->text_options_back_button = NULL;
     }
 
-    if (hud->text_options_volume_value != NULL) {
-        TTF_DestroyText(hud->text_options_volume_value);
-        hud->text_options_volume_value = NULL;
-    }
-
-    if (hud->text_options_resume_value != NULL) {
-        TTF_DestroyText(hud->text_options_resume_value);
-        hud->text_options_resume_value = NULL;
-    }
+    glyph_atlas_destroy(&hud->glyphs);
 }
 
 bool snake_hud_update_score(snake_hud_t* hud, size_t score) {
     SDL_assert(hud != NULL);
-    SDL_assert(hud->text_score != NULL);
 
     const int written = snprintf(hud->text_score_buffer, sizeof(hud->text_score_buffer), "Score: %zu", score);
     if (written < 0 || (size_t)written >= sizeof(hud->text_score_buffer)) {
@@ -423,11 +318,7 @@ bool snake_hud_update_score(snake_hud_t* hud, size_t score) {
         return false;
     }
 
-    if (TTF_SetTextString(hud->text_score, hud->text_score_buffer, (size_t)written) == false) {
-        SDL_Log("Failed to update score text: %s", SDL_GetError());
-        return false;
-    }
-
+    hud->text_revision++;
     return true;
 }
 
@@ -442,7 +333,6 @@ bool snake_hud_update_pause(snake_hud_t* hud, size_t score) {
 
 bool snake_hud_update_game_over(snake_hud_t* hud, size_t score, size_t high_score) {
     SDL_assert(hud != NULL);
-    SDL_assert(hud->text_game_over_score != NULL);
 
     const int written = snprintf(hud->text_game_over_score_buffer, sizeof(hud->text_game_over_score_buffer),
                                  "Final Score: %zu | High Score: %zu", score, high_score);
@@ -451,17 +341,12 @@ bool snake_hud_update_game_over(snake_hud_t* hud, size_t score, size_t high_scor
         return false;
     }
 
-    if (TTF_SetTextString(hud->text_game_over_score, hud->text_game_over_score_buffer, (size_t)written) == false) {
-        SDL_Log("Failed to update game over score text: %s", SDL_GetError());
-        return false;
-    }
-
+    hud->text_revision++;
     return true;
 }
 
-bool snake_hud_update_start_high_score(snake_hud_t* hud, window_t* window, size_t high_score) {
+bool snake_hud_update_start_high_score(snake_hud_t* hud, size_t high_score) {
     SDL_assert(hud != NULL);
-    SDL_assert(window != NULL);
 
     const int written = snprintf(hud->text_start_high_score_buffer, sizeof(hud->text_start_high_score_buffer),
                                  "High Score: %zu", high_score);
@@ -470,30 +355,12 @@ bool snake_hud_update_start_high_score(snake_hud_t* hud, window_t* window, size_
         return false;
     }
 
-    if (hud->text_start_high_score == NULL) {
-        hud->text_start_high_score = TTF_CreateText(window->ttf_text_engine, window->ttf_font_default,
-                                                    hud->text_start_high_score_buffer, (size_t)written);
-        if (hud->text_start_high_score == NULL) {
-            SDL_Log("Failed to create start high score text object: %s", SDL_GetError());
-            return false;
-        }
-        if (TTF_SetTextColor(hud->text_start_high_score, 255, 255, 255, 255) == false) {
-            SDL_Log("Failed to set start high score text color: %s", SDL_GetError());
-            return false;
-        }
-    }
-
-    if (TTF_SetTextString(hud->text_start_high_score, hud->text_start_high_score_buffer, (size_t)written) == false) {
-        SDL_Log("Failed to update start high score text: %s", SDL_GetError());
-        return false;
-    }
-
+    hud->text_revision++;
     return true;
 }
 
-bool snake_hud_update_options_volume(snake_hud_t* hud, window_t* window, float volume) {
+bool snake_hud_update_options_volume(snake_hud_t* hud, float volume) {
     SDL_assert(hud != NULL);
-    SDL_assert(window != NULL);
 
     const int written =
         snprintf(hud->text_options_volume_value_buffer, sizeof(hud->text_options_volume_value_buffer), "%.2f", volume);
@@ -502,31 +369,12 @@ bool snake_hud_update_options_volume(snake_hud_t* hud, window_t* window, float v
         return false;
     }
 
-    if (hud->text_options_volume_value == NULL) {
-        hud->text_options_volume_value = TTF_CreateText(window->ttf_text_engine, window->ttf_font_default,
-                                                        hud->text_options_volume_value_buffer, (size_t)written);
-        if (hud->text_options_volume_value == NULL) {
-            SDL_Log("Failed to create options volume value text: %s", SDL_GetError());
-            return false;
-        }
-        if (TTF_SetTextColor(hud->text_options_volume_value, 255, 255, 255, 255) == false) {
-            SDL_Log("Failed to set options volume value text color: %s", SDL_GetError());
-            return false;
-        }
-    }
-
-    if (TTF_SetTextString(hud->text_options_volume_value, hud->text_options_volume_value_buffer, (size_t)written) ==
-        false) {
-        SDL_Log("Failed to update options volume value text: %s", SDL_GetError());
-        return false;
-    }
-
+    hud->text_revision++;
     return true;
 }
 
-bool snake_hud_update_options_resume_delay(snake_hud_t* hud, window_t* window, int resume_delay_seconds) {
+bool snake_hud_update_options_resume_delay(snake_hud_t* hud, int resume_delay_seconds) {
     SDL_assert(hud != NULL);
-    SDL_assert(window != NULL);
 
     const int written = snprintf(hud->text_options_resume_value_buffer, sizeof(hud->text_options_resume_value_buffer),
                                  "%d", resume_delay_seconds);
@@ -535,31 +383,12 @@ bool snake_hud_update_options_resume_delay(snake_hud_t* hud, window_t* window, i
         return false;
     }
 
-    if (hud->text_options_resume_value == NULL) {
-        hud->text_options_resume_value = TTF_CreateText(window->ttf_text_engine, window->ttf_font_default,
-                                                        hud->text_options_resume_value_buffer, (size_t)written);
-        if (hud->text_options_resume_value == NULL) {
-            SDL_Log("Failed to create resume delay value text: %s", SDL_GetError());
-            return false;
-        }
-        if (TTF_SetTextColor(hud->text_options_resume_value, 255, 255, 255, 255) == false) {
-            SDL_Log("Failed to set resume delay value text color: %s", SDL_GetError());
-            return false;
-        }
-    }
-
-    if (TTF_SetTextString(hud->text_options_resume_value, hud->text_options_resume_value_buffer, (size_t)written) ==
-        false) {
-        SDL_Log("Failed to update resume delay value text: %s", SDL_GetError());
-        return false;
-    }
-
+    hud->text_revision++;
     return true;
 }
 
-bool snake_hud_update_resume_countdown(snake_hud_t* hud, window_t* window, int seconds) {
+bool snake_hud_update_resume_countdown(snake_hud_t* hud, int seconds) {
     SDL_assert(hud != NULL);
-    SDL_assert(window != NULL);
 
     if (seconds < 0) {
         seconds = 0;
@@ -572,7 +401,8 @@ bool snake_hud_update_resume_countdown(snake_hud_t* hud, window_t* window, int s
         return false;
     }
 
-    return create_resume_countdown_text(hud, window, (size_t)written);
+    hud->text_revision++;
+    return true;
 }
 
 void snake_hud_start_menu_fade(snake_hud_t* hud) {
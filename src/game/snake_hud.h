@@ -5,10 +5,18 @@
 #include <SDL3_ttf/SDL_ttf.h>
 #include "../modules/window.h"
 #include "../modules/config.h"
-#include "../utils/vector.h"
+#include "../modules/glyph_atlas.h"
 
+/**
+ * @brief Texts of the score display and the menus.
+ *
+ * Fixed labels are TTF_Text objects. Texts holding numbers that change during play (score, high score, countdown and
+ * option values) are only formatted into their buffers and drawn from the glyph atlas, so updating them never shapes
+ * text or creates a texture.
+ */
 typedef struct {
-    TTF_Text* text_score;
+    glyph_atlas_t glyphs;
+
     char text_score_buffer[32];
 
     TTF_Text* text_pause;
@@ -19,19 +27,15 @@ typedef struct {
 
     TTF_Text* text_start_title;
     TTF_Text* text_start_button;
-    TTF_Text* text_start_high_score;
     char text_start_high_score_buffer[48];
     TTF_Text* text_options_button;
 
     TTF_Text* text_game_over_title;
-    TTF_Text* text_game_over_score;
-    char text_game_over_score_buffer[80];
+    char text_game_over_score_buffer[GLYPH_ATLAS_MAX_TEXT];
     TTF_Text* text_restart_button;
 
     TTF_Text* text_resume_title;
     char text_resume_countdown_buffer[16];
-    SDL_Texture* text_resume_countdown_texture;
-    vector2i_t text_resume_countdown_size;
 
     TTF_Text* text_options_title;
     TTF_Text* text_options_volume_label;
@@ -39,13 +43,14 @@ typedef struct {
     TTF_Text* text_options_resume_label;
     TTF_Text* text_options_back_button;
 
-    TTF_Text* text_options_volume_value;
     char text_options_volume_value_buffer[16];
-    TTF_Text* text_options_resume_value;
     char text_options_resume_value_buffer[8];
 
     Uint64 menu_fade_start_ms;
     float menu_fade_alpha;
+
+    /* Bumped whenever one of the texts above changes, so anything composed from them knows to rebuild. */
+    Uint64 text_revision;
 } snake_hud_t;
 
 bool snake_hud_create(snake_hud_t* hud, window_t* window, game_config_t* config);
@@ -54,10 +59,10 @@ void snake_hud_destroy(snake_hud_t* hud);
 bool snake_hud_update_score(snake_hud_t* hud, size_t score);
 bool snake_hud_update_pause(snake_hud_t* hud, size_t score);
 bool snake_hud_update_game_over(snake_hud_t* hud, size_t score, size_t high_score);
-bool snake_hud_update_resume_countdown(snake_hud_t* hud, window_t* window, int seconds);
-bool snake_hud_update_start_high_score(snake_hud_t* hud, window_t* window, size_t high_score);
-bool snake_hud_update_options_volume(snake_hud_t* hud, window_t* window, float volume);
-bool snake_hud_update_options_resume_delay(snake_hud_t* hud, window_t* window, int resume_delay_seconds);
+bool snake_hud_update_resume_countdown(snake_hud_t* hud, int seconds);
+bool snake_hud_update_start_high_score(snake_hud_t* hud, size_t high_score);
+bool snake_hud_update_options_volume(snake_hud_t* hud, float volume);
+bool snake_hud_update_options_resume_delay(snake_hud_t* hud, int resume_delay_seconds);
 
 void snake_hud_start_menu_fade(snake_hud_t* hud);
 
@@ -20,7 +20,7 @@ static void snake_options_set_volume(snake_t* snake, float volume) {
     if (snake_apply_audio_settings(snake) == false) {
         SDL_Log("Failed to apply audio volume settings");
     }
-    if (snake_hud_update_options_volume(&snake->hud, &snake->window, snake->config.volume) == false) {
+    if (snake_hud_update_options_volume(&snake->hud, snake->config.volume) == false) {
         snake->window.is_running = false;
         return;
     }
@@ -57,8 +57,7 @@ static void snake_options_set_resume_delay(snake_t* snake, int seconds) {
     }
 
     snake->config.resume_delay_seconds = seconds;
-    if (snake_hud_update_options_resume_delay(&snake->hud, &snake->window, snake->config.resume_delay_seconds) ==
-        false) {
+    if (snake_hud_update_options_resume_delay(&snake->hud, snake->config.resume_delay_seconds) == false) {
         snake->window.is_running = false;
         return;
     }
@@ -67,58 +66,121 @@ static void snake_options_set_resume_delay(snake_t* snake, int seconds) {
     }
 }
 
-static bool snake_options_handle_mouse(snake_t* snake, float mouse_x, float mouse_y, bool pressed) {
+static void snake_toggle_fullscreen(snake_t* snake) {
     SDL_assert(snake != NULL);
 
-    snake_options_layout_t layout;
-    if (snake_options_layout_get(snake, &layout) == false) {
-        return false;
+    if (window_set_fullscreen(&snake->window, !snake->window.is_fullscreen) == false) {
+        return;
     }
+    snake->config.fullscreen = snake->window.is_fullscreen;
+    if (snake_save_config(snake) == false) {
+        SDL_Log("Failed to save config after fullscreen toggle");
+    }
+}
 
-    if (pressed == true) {
-        if (ui_slider_contains(&layout.volume_slider, mouse_x, mouse_y) == true) {
-            snake->options_dragging_volume = true;
-            snake->options_dragging_resume = false;
-            snake_options_set_volume(snake, ui_slider_get_value(&layout.volume_slider, mouse_x));
-            return true;
-        }
+/**
+ * @brief Resize text for a new display scale and rebuild everything measured from it.
+ */
+static void snake_handle_display_scale_change(snake_t* snake) {
+    SDL_assert(snake != NULL);
 
-        if (ui_checkbox_contains(&layout.mute_checkbox, mouse_x, mouse_y) == true) {
-            snake_options_toggle_mute(snake);
-            return true;
-        }
+    if (window_update_display_scale(&snake->window) == false ||
+        glyph_atlas_rebuild(&snake->hud.glyphs, snake->window.sdl_renderer) == false) {
+        snake->window.is_running = false;
+        return;
+    }
+    snake_menu_cache_invalidate(&snake->menu_cache);
+}
 
-        if (ui_slider_int_contains(&layout.resume_slider, mouse_x, mouse_y) == true) {
-            snake->options_dragging_resume = true;
-            snake->options_dragging_volume = false;
-            snake_options_set_resume_delay(snake,
-                                           snake_options_get_resume_delay_from_mouse(&layout.resume_slider, mouse_x));
-            return true;
-        }
+/**
+ * @brief Return from the options menu to the menu it was opened from.
+ */
+static void snake_options_close(snake_t* snake) {
+    SDL_assert(snake != NULL);
 
-        if (ui_button_contains(&layout.back_button, mouse_x, mouse_y) == true) {
-            snake->state = snake->options_return_state;
-            if (snake->state == SNAKE_STATE_PAUSED) {
-                if (snake_hud_update_pause(&snake->hud, snake->array_body.size) == false) {
-                    snake->window.is_running = false;
-                }
-            }
-            snake->options_dragging_volume = false;
-            snake->options_dragging_resume = false;
-            return true;
+    snake->state = snake->options_return_state;
+    if (snake->state == SNAKE_STATE_PAUSED) {
+        if (snake_hud_update_pause(&snake->hud, snake_sim_get_score(&snake->sim)) == false) {
+            snake->window.is_running = false;
         }
     }
+}
 
-    if (snake->options_dragging_volume == true && pressed == true) {
-        snake_options_set_volume(snake, ui_slider_get_value(&layout.volume_slider, mouse_x));
+/**
+ * @brief Move a slider of the options menu to the pointer, if one is held.
+ */
+static void snake_options_drag(snake_t* snake, int widget, float mouse_x) {
+    SDL_assert(snake != NULL);
+
+    if (widget != SNAKE_UI_VOLUME_SLIDER && widget != SNAKE_UI_RESUME_SLIDER) {
+        return;
     }
 
-    if (snake->options_dragging_resume == true && pressed == true) {
+    snake_options_layout_t layout;
+    if (snake_options_layout_get(snake, &layout) == false) {
+        return;
+    }
+
+    if (widget == SNAKE_UI_VOLUME_SLIDER) {
+        snake_options_set_volume(snake, ui_slider_get_value(&layout.volume_slider, mouse_x));
+    } else {
         snake_options_set_resume_delay(snake,
                                        snake_options_get_resume_delay_from_mouse(&layout.resume_slider, mouse_x));
     }
+}
+
+/**
+ * @brief Act on a press of one of the current menu's widgets.
+ */
+static void snake_handle_menu_press(snake_t* snake, int widget, float mouse_x) {
+    SDL_assert(snake != NULL);
 
-    return true;
+    switch (snake->state) {
+        case SNAKE_STATE_PAUSED:
+            if (widget == SNAKE_UI_PRIMARY_BUTTON) {
+                snake_state_begin_resume(snake);
+            } else if (widget == SNAKE_UI_SECONDARY_BUTTON) {
+                snake_state_begin_options(snake, SNAKE_STATE_PAUSED);
+            } else if (widget == SNAKE_UI_TERTIARY_BUTTON) {
+                snake->window.is_running = false;
+            }
+            break;
+
+        case SNAKE_STATE_START:
+            if (widget == SNAKE_UI_PRIMARY_BUTTON) {
+                if (snake_state_reset(snake) == false) {
+                    snake->window.is_running = false;
+                    return;
+                }
+                snake->state = SNAKE_STATE_PLAYING;
+            } else if (widget == SNAKE_UI_SECONDARY_BUTTON) {
+                snake_state_begin_options(snake, SNAKE_STATE_START);
+            }
+            break;
+
+        case SNAKE_STATE_GAME_OVER:
+            if (widget == SNAKE_UI_PRIMARY_BUTTON) {
+                if (snake_state_reset(snake) == false) {
+                    snake->window.is_running = false;
+                    return;
+                }
+                snake->state = SNAKE_STATE_PLAYING;
+            }
+            break;
+
+        case SNAKE_STATE_OPTIONS:
+            if (widget == SNAKE_UI_MUTE_CHECKBOX) {
+                snake_options_toggle_mute(snake);
+            } else if (widget == SNAKE_UI_BACK_BUTTON) {
+                snake_options_close(snake);
+            } else {
+                snake_options_drag(snake, widget, mouse_x);
+            }
+            break;
+
+        default:
+            break;
+    }
 }
 
 void snake_handle_events(snake_t* snake) {
@@ -126,16 +188,35 @@ void snake_handle_events(snake_t* snake) {
 
     SDL_Event event;
     while (SDL_PollEvent(&event)) {
+        // Mouse positions arrive in window coordinates, while layouts are in output pixels.
+        SDL_ConvertEventToRenderCoordinates(snake->window.sdl_renderer, &event);
+
         if (event.type == SDL_EVENT_QUIT) {
             snake->window.is_running = false;
         }
 
+        // Layouts are measured in pixels, so a resize or a move to a display with another scale makes them stale.
+        if (event.type == SDL_EVENT_WINDOW_PIXEL_SIZE_CHANGED) {
+            snake_menu_cache_invalidate(&snake->menu_cache);
+        } else if (event.type == SDL_EVENT_WINDOW_DISPLAY_SCALE_CHANGED) {
+            snake_handle_display_scale_change(snake);
+        }
+
+        // Render target contents are lost when the renderer resets, and every texture with a device reset.
+        if (event.type == SDL_EVENT_RENDER_TARGETS_RESET) {
+            snake_menu_cache_invalidate(&snake->menu_cache);
+        } else if (event.type == SDL_EVENT_RENDER_DEVICE_RESET) {
+            snake_menu_cache_destroy(&snake->menu_cache);
+            snake_board_release_texture(&snake->board);
+            glyph_atlas_release_texture(&snake->hud.glyphs);
+        }
+
         if (event.type == SDL_EVENT_KEY_DOWN) {
             if (event.key.scancode == SDL_SCANCODE_ESCAPE && event.key.repeat == 0) {
                 if (snake->state == SNAKE_STATE_PLAYING) {
                     snake->state = SNAKE_STATE_PAUSED;
                     snake_hud_start_menu_fade(&snake->hud);
-                    if (snake_hud_update_pause(&snake->hud, snake->array_body.size) == false) {
+                    if (snake_hud_update_pause(&snake->hud, snake_sim_get_score(&snake->sim)) == false) {
                         snake->window.is_running = false;
                     }
                 } else if (snake->state == SNAKE_STATE_PAUSED) {
@@ -149,89 +230,54 @@ void snake_handle_events(snake_t* snake) {
                 }
             }
 
-            snake_state_handle_movement_key(snake, event.key.scancode);
-        }
-
-        if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN && event.button.button == SDL_BUTTON_LEFT &&
-            event.button.down == true) {
-            if (snake->state == SNAKE_STATE_PAUSED) {
-                snake_menu_layout_t layout;
-                if (snake_menu_get_layout_with_three_buttons(
-                        snake, snake->hud.text_pause, snake->hud.text_score, true, snake->hud.text_resume, true,
-                        snake->hud.text_options_button, true, snake->hud.text_exit_button, true, &layout) == false) {
-                    return;
-                }
-
-                ui_button_t button = {0};
-                button.rect = layout.button_rect;
-                if (ui_button_contains(&button, event.button.x, event.button.y) == true) {
-                    snake_state_begin_resume(snake);
-                }
+            if (event.key.scancode == SDL_SCANCODE_F11 && event.key.repeat == 0) {
+                snake_toggle_fullscreen(snake);
+            }
 
-                ui_button_t options_button = {0};
-                options_button.rect = layout.secondary_button_rect;
-                if (ui_button_contains(&options_button, event.button.x, event.button.y) == true) {
-                    snake_state_begin_options(snake, SNAKE_STATE_PAUSED);
-                }
+            if (event.key.scancode == SDL_SCANCODE_F3 && event.key.repeat == 0) {
+                snake->show_latency_overlay = snake->show_latency_overlay == false;
+            }
 
-                ui_button_t exit_button = {0};
-                exit_button.rect = layout.tertiary_button_rect;
-                if (ui_button_contains(&exit_button, event.button.x, event.button.y) == true) {
-                    snake->window.is_running = false;
-                }
-            } else if (snake->state == SNAKE_STATE_START) {
-                snake_menu_layout_t layout;
-                if (snake_menu_get_layout_with_secondary_button(
-                        snake, snake->hud.text_start_title, snake->hud.text_start_high_score, true,
-                        snake->hud.text_start_button, true, snake->hud.text_options_button, true, &layout) == false) {
-                    return;
-                }
+            snake_state_handle_movement_key(snake, event.key.scancode, event.key.timestamp);
+        }
 
-                ui_button_t button = {0};
-                button.rect = layout.button_rect;
-                if (ui_button_contains(&button, event.button.x, event.button.y) == true) {
-                    if (snake_state_reset(snake) == false) {
-                        snake->window.is_running = false;
-                        return;
-                    }
-                    snake->state = SNAKE_STATE_PLAYING;
-                }
+        // Menus are hit-tested against their retained widget tree; nothing is clickable while playing.
+        if (snake->state == SNAKE_STATE_PLAYING) {
+            continue;
+        }
 
-                ui_button_t options_button = {0};
-                options_button.rect = layout.secondary_button_rect;
-                if (ui_button_contains(&options_button, event.button.x, event.button.y) == true) {
-                    snake_state_begin_options(snake, SNAKE_STATE_START);
-                }
-            } else if (snake->state == SNAKE_STATE_GAME_OVER) {
-                snake_menu_layout_t layout;
-                if (snake_menu_get_layout(snake, snake->hud.text_game_over_title, snake->hud.text_game_over_score, true,
-                                          snake->hud.text_restart_button, true, &layout) == false) {
-                    return;
-                }
+        if (event.type == SDL_EVENT_MOUSE_BUTTON_DOWN && event.button.button == SDL_BUTTON_LEFT &&
+            event.button.down == true) {
+            if (snake_menu_update_ui(snake) == false) {
+                return;
+            }
+            const snake_game_state_t state = snake->state;
+            const int widget = ui_tree_pointer_down(&snake->menu_cache.ui, event.button.x, event.button.y);
+            snake_handle_menu_press(snake, widget, event.button.x);
 
-                ui_button_t button = {0};
-                button.rect = layout.button_rect;
-                if (ui_button_contains(&button, event.button.x, event.button.y) == true) {
-                    if (snake_state_reset(snake) == false) {
-                        snake->window.is_running = false;
-                        return;
-                    }
-                    snake->state = SNAKE_STATE_PLAYING;
-                }
-            } else if (snake->state == SNAKE_STATE_OPTIONS) {
-                snake_options_handle_mouse(snake, event.button.x, event.button.y, true);
+            // The press led somewhere else, so its release belongs to no widget there.
+            if (snake->state != state) {
+                ui_tree_reset_pointer(&snake->menu_cache.ui);
             }
         }
 
-        if (event.type == SDL_EVENT_MOUSE_MOTION && snake->state == SNAKE_STATE_OPTIONS) {
-            const bool dragging_slider = snake->options_dragging_volume || snake->options_dragging_resume;
-            snake_options_handle_mouse(snake, event.motion.x, event.motion.y, dragging_slider);
+        if (event.type == SDL_EVENT_MOUSE_MOTION) {
+            if (snake_menu_update_ui(snake) == false) {
+                return;
+            }
+            ui_tree_t* const ui = &snake->menu_cache.ui;
+            ui_tree_pointer_move(ui, event.motion.x, event.motion.y);
+            if (snake->state == SNAKE_STATE_OPTIONS) {
+                snake_options_drag(snake, ui->pressed_id, event.motion.x);
+            }
         }
 
         if (event.type == SDL_EVENT_MOUSE_BUTTON_UP && event.button.button == SDL_BUTTON_LEFT &&
-            event.button.down == false && snake->state == SNAKE_STATE_OPTIONS) {
-            snake->options_dragging_volume = false;
-            snake->options_dragging_resume = false;
+            event.button.down == false) {
+            if (snake_menu_update_ui(snake) == false) {
+                return;
+            }
+            ui_tree_pointer_up(&snake->menu_cache.ui, event.button.x, event.button.y);
         }
     }
 }
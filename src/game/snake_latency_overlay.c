@@ -0,0 +1,106 @@
+#include "snake_latency_overlay.h"
+
+#include <SDL3/SDL_log.h>
+
+static const SDL_Color k_color_background = {0, 0, 0, 180};
+static const SDL_Color k_color_bar = {80, 160, 100, 255};
+static const SDL_FColor k_color_text = {1.0f, 1.0f, 1.0f, 1.0f};
+
+/* Distances below are at a display scale of 1 and grow with window_t::display_scale. */
+static const float k_margin = 8.f;
+static const float k_padding = 6.f;
+static const float k_bar_width = 4.f;
+static const float k_histogram_height = 48.f;
+
+static const double k_ns_per_ms = 1000000.0;
+
+static const char* const k_stage_labels[SNAKE_LATENCY_STAGE_COUNT] = {"input>tick", "tick>present", "input>present"};
+
+bool snake_latency_overlay_render(snake_t* snake) {
+    SDL_assert(snake != NULL);
+
+    SDL_Renderer* const renderer = snake->window.sdl_renderer;
+    glyph_atlas_t* const glyphs = &snake->hud.glyphs;
+    const float scale = snake->window.display_scale;
+    const float line_height = (float)glyphs->line_height;
+
+    char lines[SNAKE_LATENCY_STAGE_COUNT][GLYPH_ATLAS_MAX_TEXT];
+    float text_width = 0.f;
+    for (int stage = 0; stage < SNAKE_LATENCY_STAGE_COUNT; ++stage) {
+        const snake_latency_histogram_t* const histogram = &snake->latency.histograms[stage];
+        SDL_snprintf(lines[stage], sizeof(lines[stage]), "%-13s p50 %5.1f p99 %5.1f max %5.1f ms",
+                     k_stage_labels[stage],
+                     (double)snake_latency_histogram_get_percentile(histogram, 0.5f) / k_ns_per_ms,
+                     (double)snake_latency_histogram_get_percentile(histogram, 0.99f) / k_ns_per_ms,
+                     (double)histogram->max_ns / k_ns_per_ms);
+
+        vector2i_t size;
+        glyph_atlas_measure(glyphs, lines[stage], &size);
+        text_width = SDL_max(text_width, (float)size.x);
+    }
+
+    const float histogram_width = k_bar_width * scale * SNAKE_LATENCY_BUCKET_COUNT;
+    const float x = k_margin * scale;
+    const float y = k_margin * scale;
+    const float padding = k_padding * scale;
+    const float histogram_height = k_histogram_height * scale;
+    const SDL_FRect background = {x, y, SDL_max(histogram_width, text_width) + padding * 2.f,
+                                  line_height * SNAKE_LATENCY_STAGE_COUNT + histogram_height + padding * 3.f};
+
+    if (SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND) == false) {
+        SDL_Log("Failed to set blend mode: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+    SDL_SetRenderDrawColor(renderer, k_color_background.r, k_color_background.g, k_color_background.b,
+                           k_color_background.a);
+    SDL_RenderFillRect(renderer, &background);
+    if (SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE) == false) {
+        SDL_Log("Failed to reset blend mode: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    const float text_x = x + padding;
+    float text_y = y + padding;
+    for (int stage = 0; stage < SNAKE_LATENCY_STAGE_COUNT; ++stage) {
+        if (glyph_atlas_draw(glyphs, renderer, lines[stage], text_x, text_y, k_color_text) == false) {
+            SDL_Log("Failed to render latency overlay text");
+            snake->window.is_running = false;
+            return false;
+        }
+        text_y += line_height;
+    }
+
+    // One bar per bucket of the full input-to-present latency, scaled to the fullest bucket.
+    const snake_latency_histogram_t* const total = &snake->latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_PRESENT];
+    uint32_t fullest = 0;
+    for (int i = 0; i < SNAKE_LATENCY_BUCKET_COUNT; ++i) {
+        fullest = SDL_max(fullest, total->buckets[i]);
+    }
+    if (fullest == 0) {
+        return true;
+    }
+
+    SDL_FRect bars[SNAKE_LATENCY_BUCKET_COUNT];
+    int bar_count = 0;
+    const float baseline = text_y + padding + histogram_height;
+    for (int i = 0; i < SNAKE_LATENCY_BUCKET_COUNT; ++i) {
+        if (total->buckets[i] == 0) {
+            continue;
+        }
+        const float height = SDL_ceilf(histogram_height * (float)total->buckets[i] / (float)fullest);
+        bars[bar_count] = (SDL_FRect){text_x + k_bar_width * scale * (float)i, baseline - height,
+                                      SDL_max(k_bar_width * scale - 1.f, 1.f), height};
+        bar_count++;
+    }
+
+    SDL_SetRenderDrawColor(renderer, k_color_bar.r, k_color_bar.g, k_color_bar.b, k_color_bar.a);
+    if (SDL_RenderFillRects(renderer, bars, bar_count) == false) {
+        SDL_Log("Failed to render latency histogram: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    return true;
+}
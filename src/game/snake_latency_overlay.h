@@ -0,0 +1,14 @@
+#ifndef SNAKE_LATENCY_OVERLAY_H
+#define SNAKE_LATENCY_OVERLAY_H
+
+#include "../snake.h"
+
+/**
+ * @brief Draw the latency debug overlay in the top-left corner: a summary line per stage and a histogram of the
+ *        full input-to-present latency.
+ *
+ * On failure logs the error, sets window.is_running = false and returns false.
+ */
+bool snake_latency_overlay_render(snake_t* snake);
+
+#endif  // SNAKE_LATENCY_OVERLAY_H
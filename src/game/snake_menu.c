@@ -1,10 +1,13 @@
 #include "snake_menu.h"
 
+#include <string.h>
 #include <SDL3/SDL_log.h>
 
+#include "snake_options_layout.h"
 #include "snake_util.h"
 #include "../modules/ui.h"
 
+/* Spacing at a display scale of 1; compute_menu_layout() multiplies it by window_t::display_scale. */
 static const float k_menu_panel_padding = 20.f;
 static const float k_menu_text_gap = 16.f;
 static const float k_menu_button_padding_x = 28.f;
@@ -13,12 +16,18 @@ static const float k_menu_button_padding_y = 12.f;
 static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t* title_size,
                                 const vector2i_t* subtitle_size, bool has_subtitle, const vector2i_t* button_label_size,
                                 bool has_button, const vector2i_t* secondary_button_size, bool has_secondary,
-                                const vector2i_t* tertiary_button_size, bool has_tertiary,
+                                const vector2i_t* tertiary_button_size, bool has_tertiary, float scale,
                                 snake_menu_layout_t* out_layout) {
     SDL_assert(screen_size != NULL);
     SDL_assert(title_size != NULL);
     SDL_assert(button_label_size != NULL);
     SDL_assert(out_layout != NULL);
+    SDL_assert(scale > 0.f);
+
+    const float panel_padding = k_menu_panel_padding * scale;
+    const float text_gap = k_menu_text_gap * scale;
+    const float button_padding_x = k_menu_button_padding_x * scale;
+    const float button_padding_y = k_menu_button_padding_y * scale;
 
     ui_button_t button;
     ui_button_init(&button, (SDL_Color){0, 0, 0, 0}, (SDL_Color){0, 0, 0, 0});
@@ -26,8 +35,8 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
     float button_width = 0.f;
     float button_height = 0.f;
     if (has_button == true && button_label_size != NULL) {
-        ui_button_layout_from_label(&button, button_label_size, 0.f, 0.f, k_menu_button_padding_x,
-                                    k_menu_button_padding_y);
+        ui_button_layout_from_label(&button, button_label_size, 0.f, 0.f, button_padding_x,
+                                    button_padding_y);
         button_width = button.rect.w;
         button_height = button.rect.h;
     }
@@ -35,8 +44,8 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
     float secondary_button_width = 0.f;
     float secondary_button_height = 0.f;
     if (has_secondary == true && secondary_button_size != NULL) {
-        ui_button_layout_from_label(&button, secondary_button_size, 0.f, 0.f, k_menu_button_padding_x,
-                                    k_menu_button_padding_y);
+        ui_button_layout_from_label(&button, secondary_button_size, 0.f, 0.f, button_padding_x,
+                                    button_padding_y);
         secondary_button_width = button.rect.w;
         secondary_button_height = button.rect.h;
     }
@@ -55,8 +64,8 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
     float tertiary_button_width = 0.f;
     float tertiary_button_height = 0.f;
     if (has_tertiary == true && tertiary_button_size != NULL) {
-        ui_button_layout_from_label(&button, tertiary_button_size, 0.f, 0.f, k_menu_button_padding_x,
-                                    k_menu_button_padding_y);
+        ui_button_layout_from_label(&button, tertiary_button_size, 0.f, 0.f, button_padding_x,
+                                    button_padding_y);
         tertiary_button_width = button.rect.w;
         tertiary_button_height = button.rect.h;
         content_width = SDL_max(content_width, tertiary_button_width);
@@ -64,33 +73,33 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
 
     float content_height = (float)title_size->y;
     if (has_subtitle == true && subtitle_size != NULL) {
-        content_height += k_menu_text_gap + (float)subtitle_size->y;
+        content_height += text_gap + (float)subtitle_size->y;
     }
     if (has_button == true) {
-        content_height += k_menu_text_gap + button_height;
+        content_height += text_gap + button_height;
     }
     if (has_secondary == true) {
-        content_height += k_menu_text_gap + secondary_button_height;
+        content_height += text_gap + secondary_button_height;
     }
     if (has_tertiary == true) {
-        content_height += k_menu_text_gap + tertiary_button_height;
+        content_height += text_gap + tertiary_button_height;
     }
 
     vector2i_t content_size = {(int)(content_width + 0.5f), (int)(content_height + 0.5f)};
 
     ui_panel_t panel;
     ui_panel_init(&panel, (SDL_Color){0, 0, 0, 0}, (SDL_Color){0, 0, 0, 0});
-    ui_panel_layout_from_content(&panel, screen_size, &content_size, k_menu_panel_padding, k_menu_panel_padding);
+    ui_panel_layout_from_content(&panel, screen_size, &content_size, panel_padding, panel_padding);
     out_layout->panel_rect = panel.rect;
 
-    float cursor_y = panel.rect.y + k_menu_panel_padding;
+    float cursor_y = panel.rect.y + panel_padding;
     out_layout->title_pos.x = panel.rect.x + (panel.rect.w - (float)title_size->x) * 0.5f;
     out_layout->title_pos.y = cursor_y;
     cursor_y += (float)title_size->y;
 
     out_layout->has_subtitle = has_subtitle;
     if (has_subtitle == true && subtitle_size != NULL) {
-        cursor_y += k_menu_text_gap;
+        cursor_y += text_gap;
         out_layout->subtitle_pos.x = panel.rect.x + (panel.rect.w - (float)subtitle_size->x) * 0.5f;
         out_layout->subtitle_pos.y = cursor_y;
         cursor_y += (float)subtitle_size->y;
@@ -98,11 +107,11 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
 
     out_layout->has_button = has_button;
     if (has_button == true && button_label_size != NULL) {
-        cursor_y += k_menu_text_gap;
+        cursor_y += text_gap;
         const float button_center_x = panel.rect.x + panel.rect.w * 0.5f;
         const float button_center_y = cursor_y + button_height * 0.5f;
         ui_button_layout_from_label(&button, button_label_size, button_center_x, button_center_y,
-                                    k_menu_button_padding_x, k_menu_button_padding_y);
+                                    button_padding_x, button_padding_y);
         out_layout->button_rect = button.rect;
         cursor_y += button_height;
     } else {
@@ -111,11 +120,11 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
 
     out_layout->has_secondary_button = has_secondary;
     if (has_secondary == true && secondary_button_size != NULL) {
-        cursor_y += k_menu_text_gap;
+        cursor_y += text_gap;
         const float button_center_x = panel.rect.x + panel.rect.w * 0.5f;
         const float button_center_y = cursor_y + secondary_button_height * 0.5f;
         ui_button_layout_from_label(&button, secondary_button_size, button_center_x, button_center_y,
-                                    k_menu_button_padding_x, k_menu_button_padding_y);
+                                    button_padding_x, button_padding_y);
         out_layout->secondary_button_rect = button.rect;
         cursor_y += secondary_button_height;
     } else {
@@ -124,11 +133,11 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
 
     out_layout->has_tertiary_button = has_tertiary;
     if (has_tertiary == true && tertiary_button_size != NULL) {
-        cursor_y += k_menu_text_gap;
+        cursor_y += text_gap;
         const float button_center_x = panel.rect.x + panel.rect.w * 0.5f;
         const float button_center_y = cursor_y + tertiary_button_height * 0.5f;
         ui_button_layout_from_label(&button, tertiary_button_size, button_center_x, button_center_y,
-                                    k_menu_button_padding_x, k_menu_button_padding_y);
+                                    button_padding_x, button_padding_y);
         out_layout->tertiary_button_rect = button.rect;
         cursor_y += tertiary_button_height;
     } else {
@@ -136,7 +145,7 @@ static void compute_menu_layout(const vector2i_t* screen_size, const vector2i_t*
     }
 }
 
-bool snake_menu_get_layout(snake_t* snake, TTF_Text* title_text, TTF_Text* subtitle_text, bool has_subtitle,
+bool snake_menu_get_layout(snake_t* snake, TTF_Text* title_text, const char* subtitle_text, bool has_subtitle,
                            TTF_Text* button_text, bool has_button, snake_menu_layout_t* out_layout) {
     SDL_assert(snake != NULL);
     SDL_assert(title_text != NULL);
@@ -158,9 +167,7 @@ bool snake_menu_get_layout(snake_t* snake, TTF_Text* title_text, TTF_Text* subti
     vector2i_t subtitle_size = {0, 0};
     if (has_subtitle == true) {
         SDL_assert(subtitle_text != NULL);
-        if (snake_get_text_size(snake, subtitle_text, &subtitle_size, "subtitle") == false) {
-            return false;
-        }
+        glyph_atlas_measure(&snake->hud.glyphs, subtitle_text, &subtitle_size);
     }
 
     vector2i_t button_size = {0, 0};
@@ -173,12 +180,13 @@ bool snake_menu_get_layout(snake_t* snake, TTF_Text* title_text, TTF_Text* subti
     vector2i_t secondary_size = {0, 0};
     vector2i_t tertiary_size = {0, 0};
     compute_menu_layout(&screen_size, &title_size, &subtitle_size, has_subtitle, &button_size, has_button,
-                        &secondary_size, false, &tertiary_size, false, out_layout);
+                        &secondary_size, false, &tertiary_size, false, snake->window.display_scale, out_layout);
     return true;
 }
 
-bool snake_menu_get_layout_with_secondary_button(snake_t* snake, TTF_Text* title_text, TTF_Text* subtitle_text,
-                                                 bool has_subtitle, TTF_Text* primary_button_text, bool has_primary,
+bool snake_menu_get_layout_with_secondary_button(snake_t* snake, TTF_Text* title_text,
+                                                 const char* subtitle_text, bool has_subtitle,
+                                                 TTF_Text* primary_button_text, bool has_primary,
                                                  TTF_Text* secondary_button_text, bool has_secondary,
                                                  snake_menu_layout_t* out_layout) {
     SDL_assert(snake != NULL);
@@ -204,9 +212,7 @@ bool snake_menu_get_layout_with_secondary_button(snake_t* snake, TTF_Text* title
     vector2i_t subtitle_size = {0, 0};
     if (has_subtitle == true) {
         SDL_assert(subtitle_text != NULL);
-        if (snake_get_text_size(snake, subtitle_text, &subtitle_size, "subtitle") == false) {
-            return false;
-        }
+        glyph_atlas_measure(&snake->hud.glyphs, subtitle_text, &subtitle_size);
     }
 
     vector2i_t primary_size = {0, 0};
@@ -225,12 +231,13 @@ bool snake_menu_get_layout_with_secondary_button(snake_t* snake, TTF_Text* title
 
     vector2i_t tertiary_size = {0, 0};
     compute_menu_layout(&screen_size, &title_size, &subtitle_size, has_subtitle, &primary_size, has_primary,
-                        &secondary_size, has_secondary, &tertiary_size, false, out_layout);
+                        &secondary_size, has_secondary, &tertiary_size, false, snake->window.display_scale, out_layout);
     return true;
 }
 
-bool snake_menu_get_layout_with_three_buttons(snake_t* snake, TTF_Text* title_text, TTF_Text* subtitle_text,
-                                              bool has_subtitle, TTF_Text* primary_button_text, bool has_primary,
+bool snake_menu_get_layout_with_three_buttons(snake_t* snake, TTF_Text* title_text,
+                                              const char* subtitle_text, bool has_subtitle,
+                                              TTF_Text* primary_button_text, bool has_primary,
                                               TTF_Text* secondary_button_text, bool has_secondary,
                                               TTF_Text* tertiary_button_text, bool has_tertiary,
                                               snake_menu_layout_t* out_layout) {
@@ -260,9 +267,7 @@ bool snake_menu_get_layout_with_three_buttons(snake_t* snake, TTF_Text* title_te
     vector2i_t subtitle_size = {0, 0};
     if (has_subtitle == true) {
         SDL_assert(subtitle_text != NULL);
-        if (snake_get_text_size(snake, subtitle_text, &subtitle_size, "subtitle") == false) {
-            return false;
-        }
+        glyph_atlas_measure(&snake->hud.glyphs, subtitle_text, &subtitle_size);
     }
 
     vector2i_t primary_size = {0, 0};
@@ -287,6 +292,167 @@ bool snake_menu_get_layout_with_three_buttons(snake_t* snake, TTF_Text* title_te
     }
 
     compute_menu_layout(&screen_size, &title_size, &subtitle_size, has_subtitle, &primary_size, has_primary,
-                        &secondary_size, has_secondary, &tertiary_size, has_tertiary, out_layout);
+                        &secondary_size, has_secondary, &tertiary_size, has_tertiary, snake->window.display_scale,
+                        out_layout);
+    return true;
+}
+
+void snake_menu_get_texts(const snake_t* snake, snake_menu_texts_t* out_texts) {
+    SDL_assert(snake != NULL);
+    SDL_assert(out_texts != NULL);
+
+    out_texts->title = NULL;
+    out_texts->subtitle = NULL;
+    out_texts->button = NULL;
+
+    if (snake->state == SNAKE_STATE_PAUSED) {
+        out_texts->title = snake->hud.text_pause;
+        out_texts->subtitle = snake->hud.text_score_buffer;
+        out_texts->button = snake->hud.text_resume;
+    } else if (snake->state == SNAKE_STATE_START) {
+        out_texts->title = snake->hud.text_start_title;
+        out_texts->subtitle = snake->hud.text_start_high_score_buffer;
+        out_texts->button = snake->hud.text_start_button;
+    } else if (snake->state == SNAKE_STATE_RESUMING) {
+        out_texts->title = snake->hud.text_resume_title;
+    } else {
+        out_texts->title = snake->hud.text_game_over_title;
+        out_texts->subtitle = snake->hud.text_game_over_score_buffer;
+        out_texts->button = snake->hud.text_restart_button;
+    }
+}
+
+bool snake_menu_get_current_layout(snake_t* snake, snake_menu_layout_t* out_layout) {
+    SDL_assert(snake != NULL);
+    SDL_assert(out_layout != NULL);
+
+    snake_menu_cache_t* const cache = &snake->menu_cache;
+    if (cache->has_layout == true && cache->layout_state == snake->state &&
+        cache->layout_text_revision == snake->hud.text_revision) {
+        *out_layout = cache->layout;
+        return true;
+    }
+
+    snake_menu_texts_t texts;
+    snake_menu_get_texts(snake, &texts);
+    const bool has_subtitle = texts.subtitle != NULL;
+    const bool has_button = texts.button != NULL;
+
+    bool measured;
+    if (snake->state == SNAKE_STATE_PAUSED) {
+        measured = snake_menu_get_layout_with_three_buttons(snake, texts.title, texts.subtitle, has_subtitle,
+                                                            texts.button, has_button, snake->hud.text_options_button,
+                                                            true, snake->hud.text_exit_button, true, out_layout);
+    } else if (snake->state == SNAKE_STATE_START) {
+        measured = snake_menu_get_layout_with_secondary_button(snake, texts.title, texts.subtitle, has_subtitle,
+                                                               texts.button, has_button,
+                                                               snake->hud.text_options_button, true, out_layout);
+    } else {
+        measured = snake_menu_get_layout(snake, texts.title, texts.subtitle, has_subtitle, texts.button, has_button,
+                                         out_layout);
+    }
+    if (measured == false) {
+        cache->has_layout = false;
+        return false;
+    }
+
+    cache->layout = *out_layout;
+    cache->layout_state = snake->state;
+    cache->layout_text_revision = snake->hud.text_revision;
+    cache->has_layout = true;
+    return true;
+}
+
+/**
+ * @brief Add the options menu's panel, sliders, checkbox and back button.
+ */
+static void add_options_widgets(ui_tree_t* tree, const snake_options_layout_t* layout) {
+    SDL_FRect volume_bounds;
+    SDL_FRect resume_bounds;
+    ui_slider_get_bounds(&layout->volume_slider, &volume_bounds);
+    ui_slider_get_bounds(&layout->resume_slider.slider, &resume_bounds);
+
+    ui_tree_add(tree, SNAKE_UI_PANEL, UI_WIDGET_NONE, &layout->panel.rect);
+    ui_tree_add(tree, SNAKE_UI_VOLUME_SLIDER, SNAKE_UI_PANEL, &volume_bounds);
+    ui_tree_add(tree, SNAKE_UI_MUTE_CHECKBOX, SNAKE_UI_PANEL, &layout->mute_checkbox.rect);
+    ui_tree_add(tree, SNAKE_UI_RESUME_SLIDER, SNAKE_UI_PANEL, &resume_bounds);
+    ui_tree_add(tree, SNAKE_UI_BACK_BUTTON, SNAKE_UI_PANEL, &layout->back_button.rect);
+}
+
+/**
+ * @brief Add the overlay menu's panel and whichever of its buttons it has.
+ */
+static void add_menu_widgets(ui_tree_t* tree, const snake_menu_layout_t* layout) {
+    ui_tree_add(tree, SNAKE_UI_PANEL, UI_WIDGET_NONE, &layout->panel_rect);
+    if (layout->has_button == true) {
+        ui_tree_add(tree, SNAKE_UI_PRIMARY_BUTTON, SNAKE_UI_PANEL, &layout->button_rect);
+    }
+    if (layout->has_secondary_button == true) {
+        ui_tree_add(tree, SNAKE_UI_SECONDARY_BUTTON, SNAKE_UI_PANEL, &layout->secondary_button_rect);
+    }
+    if (layout->has_tertiary_button == true) {
+        ui_tree_add(tree, SNAKE_UI_TERTIARY_BUTTON, SNAKE_UI_PANEL, &layout->tertiary_button_rect);
+    }
+}
+
+bool snake_menu_update_ui(snake_t* snake) {
+    SDL_assert(snake != NULL);
+    SDL_assert(snake->state != SNAKE_STATE_PLAYING);
+
+    snake_menu_cache_t* const cache = &snake->menu_cache;
+    if (cache->has_ui == true && cache->ui_state == snake->state &&
+        cache->ui_text_revision == snake->hud.text_revision) {
+        return true;
+    }
+
+    vector2i_t screen_size;
+    if (snake_get_screen_size(snake, &screen_size) == false) {
+        return false;
+    }
+
+    // A press or hover on another menu means nothing here; a relayout of the same menu keeps them.
+    if (cache->has_ui == false || cache->ui_state != snake->state) {
+        ui_tree_reset_pointer(&cache->ui);
+    }
+    cache->has_ui = false;
+
+    const SDL_FRect bounds = {0.f, 0.f, (float)screen_size.x, (float)screen_size.y};
+    ui_tree_begin(&cache->ui, &bounds);
+    if (snake->state == SNAKE_STATE_OPTIONS) {
+        snake_options_layout_t layout;
+        if (snake_options_layout_get(snake, &layout) == false) {
+            return false;
+        }
+        add_options_widgets(&cache->ui, &layout);
+    } else {
+        snake_menu_layout_t layout;
+        if (snake_menu_get_current_layout(snake, &layout) == false) {
+            return false;
+        }
+        add_menu_widgets(&cache->ui, &layout);
+    }
+
+    cache->ui_state = snake->state;
+    cache->ui_text_revision = snake->hud.text_revision;
+    cache->has_ui = true;
     return true;
 }
+
+void snake_menu_cache_invalidate(snake_menu_cache_t* cache) {
+    SDL_assert(cache != NULL);
+
+    cache->is_valid = false;
+    cache->has_layout = false;
+    cache->has_options_layout = false;
+    cache->has_ui = false;
+}
+
+void snake_menu_cache_destroy(snake_menu_cache_t* cache) {
+    SDL_assert(cache != NULL);
+
+    if (cache->texture != NULL) {
+        SDL_DestroyTexture(cache->texture);
+    }
+    memset(cache, 0, sizeof(*cache));
+    ui_tree_init(&cache->ui);
+}
@@ -4,30 +4,58 @@
 #include <SDL3/SDL.h>
 
 #include "../snake.h"
+#include "snake_menu_layout.h"
 
+/**
+ * @brief Texts shown by the overlay menu of the current state. Unused entries are NULL.
+ *
+ * The subtitle carries changing numbers, so it is a plain string drawn from snake_hud_t::glyphs.
+ */
 typedef struct {
-    SDL_FRect panel_rect;
-    SDL_FRect button_rect;
-    SDL_FRect secondary_button_rect;
-    SDL_FRect tertiary_button_rect;
-    SDL_FPoint title_pos;
-    SDL_FPoint subtitle_pos;
-    bool has_subtitle;
-    bool has_button;
-    bool has_secondary_button;
-    bool has_tertiary_button;
-} snake_menu_layout_t;
-
-bool snake_menu_get_layout(snake_t* snake, TTF_Text* title_text, TTF_Text* subtitle_text, bool has_subtitle,
+    TTF_Text* title;
+    const char* subtitle;
+    TTF_Text* button;
+} snake_menu_texts_t;
+
+bool snake_menu_get_layout(snake_t* snake, TTF_Text* title_text, const char* subtitle_text, bool has_subtitle,
                            TTF_Text* button_text, bool has_button, snake_menu_layout_t* out_layout);
-bool snake_menu_get_layout_with_secondary_button(snake_t* snake, TTF_Text* title_text, TTF_Text* subtitle_text,
-                                                 bool has_subtitle, TTF_Text* primary_button_text, bool has_primary,
+bool snake_menu_get_layout_with_secondary_button(snake_t* snake, TTF_Text* title_text,
+                                                 const char* subtitle_text, bool has_subtitle,
+                                                 TTF_Text* primary_button_text, bool has_primary,
                                                  TTF_Text* secondary_button_text, bool has_secondary,
                                                  snake_menu_layout_t* out_layout);
-bool snake_menu_get_layout_with_three_buttons(snake_t* snake, TTF_Text* title_text, TTF_Text* subtitle_text,
-                                              bool has_subtitle, TTF_Text* primary_button_text, bool has_primary,
+bool snake_menu_get_layout_with_three_buttons(snake_t* snake, TTF_Text* title_text,
+                                              const char* subtitle_text, bool has_subtitle,
+                                              TTF_Text* primary_button_text, bool has_primary,
                                               TTF_Text* secondary_button_text, bool has_secondary,
                                               TTF_Text* tertiary_button_text, bool has_tertiary,
                                               snake_menu_layout_t* out_layout);
 
+/**
+ * @brief Pick the texts for the start, pause, resume or game-over menu, whichever snake->state shows.
+ */
+void snake_menu_get_texts(const snake_t* snake, snake_menu_texts_t* out_texts);
+
+/**
+ * @brief Get the layout of the menu snake->state shows, measuring the texts only when the cached layout is stale.
+ *
+ * The cache is keyed on the state and snake_hud_t::text_revision, and cleared by snake_menu_cache_invalidate() when
+ * the window size changes, so repeated frames and clicks on the same menu skip text measurement entirely.
+ */
+bool snake_menu_get_current_layout(snake_t* snake, snake_menu_layout_t* out_layout);
+
+/**
+ * @brief Bring snake_menu_cache_t::ui up to date with the menu snake->state shows, laying it out only when stale.
+ *
+ * Must not be called while playing, which shows no menu.
+ */
+bool snake_menu_update_ui(snake_t* snake);
+
+/**
+ * @brief Force the cached menu layout and layer to be rebuilt on next use, e.g. after a resize or when the renderer
+ *        lost its targets.
+ */
+void snake_menu_cache_invalidate(snake_menu_cache_t* cache);
+void snake_menu_cache_destroy(snake_menu_cache_t* cache);
+
 #endif  // SNAKE_MENU_H
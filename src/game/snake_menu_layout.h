@@ -0,0 +1,60 @@
+#ifndef SNAKE_MENU_LAYOUT_H
+#define SNAKE_MENU_LAYOUT_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_rect.h>
+
+#include "../modules/ui.h"
+
+/**
+ * @brief Ids of the widgets in snake_menu_cache_t::ui. Which are present depends on the menu shown.
+ */
+typedef enum {
+    SNAKE_UI_PANEL,
+    SNAKE_UI_PRIMARY_BUTTON,
+    SNAKE_UI_SECONDARY_BUTTON,
+    SNAKE_UI_TERTIARY_BUTTON,
+    SNAKE_UI_VOLUME_SLIDER,
+    SNAKE_UI_MUTE_CHECKBOX,
+    SNAKE_UI_RESUME_SLIDER,
+    SNAKE_UI_BACK_BUTTON
+} snake_ui_widget_t;
+
+/**
+ * @brief Where each element of an overlay menu goes, in render output pixels.
+ *
+ * The layouts here are kept apart from snake_menu.h and snake_options_layout.h so snake_t can cache them without a
+ * circular include.
+ */
+typedef struct {
+    SDL_FRect panel_rect;
+    SDL_FRect button_rect;
+    SDL_FRect secondary_button_rect;
+    SDL_FRect tertiary_button_rect;
+    SDL_FPoint title_pos;
+    SDL_FPoint subtitle_pos;
+    bool has_subtitle;
+    bool has_button;
+    bool has_secondary_button;
+    bool has_tertiary_button;
+} snake_menu_layout_t;
+
+/**
+ * @brief Where each element of the options menu goes, in render output pixels. Colors are left for the renderer.
+ */
+typedef struct {
+    ui_panel_t panel;
+    ui_slider_t volume_slider;
+    ui_checkbox_t mute_checkbox;
+    ui_slider_int_t resume_slider;
+    ui_button_t back_button;
+    SDL_FPoint title_pos;
+    SDL_FPoint volume_label_pos;
+    SDL_FPoint volume_value_pos;
+    SDL_FPoint mute_label_pos;
+    SDL_FPoint resume_label_pos;
+    SDL_FPoint resume_value_pos;
+    SDL_FPoint back_label_pos;
+} snake_options_layout_t;
+
+#endif  // SNAKE_MENU_LAYOUT_H
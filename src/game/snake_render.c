@@ -2,6 +2,8 @@
 
 #include <SDL3/SDL_log.h>
 
+#include "snake_board.h"
+#include "snake_latency_overlay.h"
 #include "snake_menu.h"
 #include "snake_options_layout.h"
 #include "snake_util.h"
@@ -11,6 +13,7 @@ static const SDL_Color k_color_menu_overlay = {0, 0, 0, 160};
 static const SDL_Color k_color_menu_panel = {25, 25, 25, 220};
 static const SDL_Color k_color_menu_panel_border = {80, 80, 80, 255};
 static const SDL_Color k_color_menu_button = {45, 45, 45, 255};
+static const SDL_Color k_color_menu_button_hover = {65, 65, 65, 255};
 static const SDL_Color k_color_menu_button_border = {100, 100, 100, 255};
 static const SDL_Color k_color_menu_checkbox = {30, 30, 30, 255};
 static const SDL_Color k_color_menu_checkbox_border = {100, 100, 100, 255};
@@ -18,6 +21,252 @@ static const SDL_Color k_color_menu_checkbox_check = {180, 180, 180, 255};
 static const SDL_Color k_color_menu_slider_track = {40, 40, 40, 255};
 static const SDL_Color k_color_menu_slider_fill = {80, 160, 100, 255};
 static const SDL_Color k_color_menu_slider_knob = {180, 180, 180, 255};
+static const SDL_FColor k_color_text = {1.0f, 1.0f, 1.0f, 1.0f};
+
+/* Distances below are at a display scale of 1 and grow with window_t::display_scale. */
+static const float k_score_margin = 10.f;
+static const float k_countdown_offset = 60.f;
+
+/**
+ * @brief Fill color of a button, lighter while the pointer is over it.
+ */
+static SDL_Color get_button_color(const snake_t* snake, snake_ui_widget_t widget) {
+    return snake->menu_cache.ui.hovered_id == (int)widget ? k_color_menu_button_hover : k_color_menu_button;
+}
+
+/**
+ * @brief Draw the overlay menu for the current state (dimming overlay, panel, buttons and text) at full opacity into
+ *        the current render target.
+ */
+static bool compose_menu(snake_t* snake, const vector2i_t* screen_size) {
+    snake_menu_texts_t texts;
+    snake_menu_get_texts(snake, &texts);
+
+    snake_menu_layout_t layout;
+    if (snake_menu_get_current_layout(snake, &layout) == false) {
+        return false;
+    }
+
+    if (SDL_SetRenderDrawBlendMode(snake->window.sdl_renderer, SDL_BLENDMODE_BLEND) == false) {
+        SDL_Log("Failed to set blend mode: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    SDL_SetRenderDrawColor(snake->window.sdl_renderer, k_color_menu_overlay.r, k_color_menu_overlay.g,
+                           k_color_menu_overlay.b, k_color_menu_overlay.a);
+
+    SDL_FRect overlay_rect = {0.f, 0.f, (float)screen_size->x, (float)screen_size->y};
+    SDL_RenderFillRect(snake->window.sdl_renderer, &overlay_rect);
+
+    ui_panel_t panel;
+    ui_panel_init(&panel, k_color_menu_panel, k_color_menu_panel_border);
+    panel.rect = layout.panel_rect;
+    if (ui_panel_render(snake->window.sdl_renderer, &panel) == false) {
+        SDL_Log("Failed to render menu panel: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    ui_button_t button;
+    if (layout.has_button == true) {
+        ui_button_init(&button, get_button_color(snake, SNAKE_UI_PRIMARY_BUTTON), k_color_menu_button_border);
+        button.rect = layout.button_rect;
+        if (ui_button_render(snake->window.sdl_renderer, &button) == false) {
+            SDL_Log("Failed to render menu button: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+    }
+
+    if (TTF_DrawRendererText(texts.title, layout.title_pos.x, layout.title_pos.y) == false) {
+        SDL_Log("Failed to render menu title text: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    if (snake->state == SNAKE_STATE_RESUMING) {
+        vector2i_t countdown_size;
+        glyph_atlas_measure(&snake->hud.glyphs, snake->hud.text_resume_countdown_buffer, &countdown_size);
+        const float countdown_x = (float)(screen_size->x - countdown_size.x) * 0.5f;
+        const float countdown_y = layout.title_pos.y + k_countdown_offset * snake->window.display_scale;
+        if (glyph_atlas_draw(&snake->hud.glyphs, snake->window.sdl_renderer, snake->hud.text_resume_countdown_buffer,
+                             countdown_x, countdown_y, k_color_text) == false) {
+            SDL_Log("Failed to render resume countdown text");
+            snake->window.is_running = false;
+            return false;
+        }
+    } else if (layout.has_subtitle == true) {
+        if (glyph_atlas_draw(&snake->hud.glyphs, snake->window.sdl_renderer, texts.subtitle, layout.subtitle_pos.x,
+                             layout.subtitle_pos.y, k_color_text) == false) {
+            SDL_Log("Failed to render menu subtitle text");
+            snake->window.is_running = false;
+            return false;
+        }
+    }
+
+    if (layout.has_button == true) {
+        vector2i_t button_text_size;
+        if (snake_get_text_size(snake, texts.button, &button_text_size, "menu button") == false) {
+            return false;
+        }
+
+        float button_text_x = 0.f;
+        float button_text_y = 0.f;
+        ui_button_get_label_position(&button, &button_text_size, &button_text_x, &button_text_y);
+        if (TTF_DrawRendererText(texts.button, button_text_x, button_text_y) == false) {
+            SDL_Log("Failed to render menu button text: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+    }
+
+    if (snake->state == SNAKE_STATE_PAUSED || snake->state == SNAKE_STATE_START) {
+        vector2i_t options_text_size;
+        if (snake_get_text_size(snake, snake->hud.text_options_button, &options_text_size, "options button") ==
+            false) {
+            return false;
+        }
+
+        ui_button_t options_button;
+        ui_button_init(&options_button, get_button_color(snake, SNAKE_UI_SECONDARY_BUTTON), k_color_menu_button_border);
+        options_button.rect = layout.secondary_button_rect;
+        if (ui_button_render(snake->window.sdl_renderer, &options_button) == false) {
+            SDL_Log("Failed to render options button: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+
+        float options_text_x = 0.f;
+        float options_text_y = 0.f;
+        ui_button_get_label_position(&options_button, &options_text_size, &options_text_x, &options_text_y);
+        if (TTF_DrawRendererText(snake->hud.text_options_button, options_text_x, options_text_y) == false) {
+            SDL_Log("Failed to render options button text: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+    }
+
+    if (snake->state == SNAKE_STATE_PAUSED) {
+        vector2i_t exit_text_size;
+        if (snake_get_text_size(snake, snake->hud.text_exit_button, &exit_text_size, "exit button") == false) {
+            return false;
+        }
+
+        ui_button_t exit_button;
+        ui_button_init(&exit_button, get_button_color(snake, SNAKE_UI_TERTIARY_BUTTON), k_color_menu_button_border);
+        exit_button.rect = layout.tertiary_button_rect;
+        if (ui_button_render(snake->window.sdl_renderer, &exit_button) == false) {
+            SDL_Log("Failed to render exit button: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+
+        float exit_text_x = 0.f;
+        float exit_text_y = 0.f;
+        ui_button_get_label_position(&exit_button, &exit_text_size, &exit_text_x, &exit_text_y);
+        if (TTF_DrawRendererText(snake->hud.text_exit_button, exit_text_x, exit_text_y) == false) {
+            SDL_Log("Failed to render exit button text: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+    }
+
+    if (SDL_SetRenderDrawBlendMode(snake->window.sdl_renderer, SDL_BLENDMODE_NONE) == false) {
+        SDL_Log("Failed to reset blend mode: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Draw the overlay menu from its cached layer, recomposing the layer first if the menu, its text or the output
+ *        size changed since it was last built.
+ */
+static bool render_menu_layer(snake_t* snake, const vector2i_t* screen_size) {
+    snake_menu_cache_t* const cache = &snake->menu_cache;
+    SDL_Renderer* const renderer = snake->window.sdl_renderer;
+
+    if (cache->texture == NULL || cache->size.x != screen_size->x || cache->size.y != screen_size->y) {
+        if (cache->texture != NULL) {
+            SDL_DestroyTexture(cache->texture);
+        }
+        cache->is_valid = false;
+        cache->texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET,
+                                           screen_size->x, screen_size->y);
+        if (cache->texture == NULL) {
+            SDL_Log("Failed to create menu layer texture: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+        cache->size = *screen_size;
+
+        // Blending onto a transparent target leaves premultiplied colors behind.
+        if (SDL_SetTextureBlendMode(cache->texture, SDL_BLENDMODE_BLEND_PREMULTIPLIED) == false) {
+            SDL_Log("Failed to set menu layer blend mode: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+    }
+
+    // Also brings the hover state up to date if the menu changed since the pointer last moved.
+    if (snake_menu_update_ui(snake) == false) {
+        snake->window.is_running = false;
+        return false;
+    }
+
+    if (cache->is_valid == false || cache->state != snake->state || cache->text_revision != snake->hud.text_revision ||
+        cache->hovered_id != cache->ui.hovered_id) {
+        if (SDL_SetRenderTarget(renderer, cache->texture) == false) {
+            SDL_Log("Failed to target menu layer: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+
+        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+        bool composed = SDL_RenderClear(renderer);
+        if (composed == false) {
+            SDL_Log("Failed to clear menu layer: %s", SDL_GetError());
+        } else {
+            composed = compose_menu(snake, screen_size);
+        }
+
+        // Always hand the window back, even when composing failed part way.
+        if (SDL_SetRenderTarget(renderer, NULL) == false) {
+            SDL_Log("Failed to restore render target: %s", SDL_GetError());
+            snake->window.is_running = false;
+            return false;
+        }
+        if (composed == false) {
+            snake->window.is_running = false;
+            return false;
+        }
+
+        cache->state = snake->state;
+        cache->text_revision = snake->hud.text_revision;
+        cache->hovered_id = cache->ui.hovered_id;
+        cache->is_valid = true;
+    }
+
+    // The layer is premultiplied, so fading scales the color channels along with alpha.
+    const float fade = snake->hud.menu_fade_alpha;
+    if (SDL_SetTextureColorModFloat(cache->texture, fade, fade, fade) == false ||
+        SDL_SetTextureAlphaModFloat(cache->texture, fade) == false) {
+        SDL_Log("Failed to fade menu layer: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    if (SDL_RenderTexture(renderer, cache->texture, NULL, NULL) == false) {
+        SDL_Log("Failed to render menu layer: %s", SDL_GetError());
+        snake->window.is_running = false;
+        return false;
+    }
+
+    return true;
+}
 
 void snake_render_frame(snake_t* snake) {
     SDL_assert(snake != NULL);
@@ -32,55 +281,32 @@ void snake_render_frame(snake_t* snake) {
         return;
     }
 
-    /* Batch rendering: all food cells share the same colour, snake cells each have
-     * a unique gradient shade.  Accumulate food rects and flush with a single call;
-     * render snake cells directly but avoid calling SetRenderDrawColor when the
-     * colour is unchanged from the previous cell. */
-    SDL_FRect food_rects[SNAKE_GRID_X * SNAKE_GRID_Y];
-    int food_rect_count = 0;
-    SDL_Color last_snake_color = {0, 0, 0, 0};
-
-    for (int x = 0; x < SNAKE_GRID_X; ++x) {
-        for (int y = 0; y < SNAKE_GRID_Y; ++y) {
-            const snake_cell_t* const cell = &snake->cells[x][y];
-
-            if (cell->state == SNAKE_CELL_FOOD) {
-                food_rects[food_rect_count++] =
-                    (SDL_FRect){(float)(x * SNAKE_CELL_SIZE), (float)(y * SNAKE_CELL_SIZE), (float)SNAKE_CELL_SIZE,
-                                (float)SNAKE_CELL_SIZE};
-            } else if (cell->state == SNAKE_CELL_SNAKE) {
-                const SDL_Color* c = &cell->render_color;
-                if (c->r != last_snake_color.r || c->g != last_snake_color.g || c->b != last_snake_color.b ||
-                    c->a != last_snake_color.a) {
-                    SDL_SetRenderDrawColor(snake->window.sdl_renderer, c->r, c->g, c->b, c->a);
-                    last_snake_color = *c;
-                }
-                SDL_FRect rect = {(float)(x * SNAKE_CELL_SIZE), (float)(y * SNAKE_CELL_SIZE), (float)SNAKE_CELL_SIZE,
-                                  (float)SNAKE_CELL_SIZE};
-                SDL_RenderFillRect(snake->window.sdl_renderer, &rect);
-            }
-            /* SNAKE_CELL_EMPTY is already black from SDL_RenderClear — no draw call needed. */
-        }
-    }
-
-    if (food_rect_count > 0) {
-        SDL_SetRenderDrawColor(snake->window.sdl_renderer, 255, 0, 0, 255);
-        SDL_RenderFillRects(snake->window.sdl_renderer, food_rects, food_rect_count);
-    }
-
     vector2i_t screen_size;
     if (snake_get_screen_size(snake, &screen_size) == false) {
         return;
     }
 
-    vector2i_t text_size;
-    if (snake_get_text_size(snake, snake->hud.text_score, &text_size, "score") == false) {
+    /* Fit the grid into the window with square cells, whatever its dimensions. */
+    snake_sim_t* const sim = &snake->sim;
+    SDL_assert(sim->cell_colors != NULL);
+    SDL_FRect board_area;
+    snake_board_get_area(sim, &screen_size, &board_area);
+
+    // Only a running game moves between ticks; anywhere else the last tick's result is what should be shown.
+    const float tick_alpha = snake->state == SNAKE_STATE_PLAYING ? timestep_get_alpha(&snake->window.time.step) : 1.0f;
+    if (snake_board_render(&snake->board, snake->window.sdl_renderer, sim, &board_area, tick_alpha) == false) {
+        snake->window.is_running = false;
         return;
     }
 
+    vector2i_t text_size;
+    glyph_atlas_measure(&snake->hud.glyphs, snake->hud.text_score_buffer, &text_size);
+
     // Render the score text at the top center of the screen.
-    if (TTF_DrawRendererText(snake->hud.text_score, (float)(screen_size.x - text_size.x) * 0.5f, 10.f) == false) {
-        SDL_Log("Failed to render score text: %s", SDL_GetError());
+    if (glyph_atlas_draw(&snake->hud.glyphs, snake->window.sdl_renderer, snake->hud.text_score_buffer,
+                         (float)(screen_size.x - text_size.x) * 0.5f, k_score_margin * snake->window.display_scale,
+                         k_color_text) == false) {
+        SDL_Log("Failed to render score text");
         snake->window.is_running = false;
         return;
     }
@@ -101,192 +327,7 @@ void snake_render_frame(snake_t* snake) {
         }
         snake->hud.menu_fade_alpha = fade_alpha;
 
-        TTF_Text* title_text = NULL;
-        TTF_Text* subtitle_text = NULL;
-        bool has_subtitle = false;
-        TTF_Text* button_text = NULL;
-        bool has_button = false;
-
-        if (snake->state == SNAKE_STATE_PAUSED) {
-            title_text = snake->hud.text_pause;
-            subtitle_text = snake->hud.text_score;
-            has_subtitle = true;
-            button_text = snake->hud.text_resume;
-            has_button = true;
-        } else if (snake->state == SNAKE_STATE_START) {
-            title_text = snake->hud.text_start_title;
-            subtitle_text = snake->hud.text_start_high_score;
-            has_subtitle = true;
-            button_text = snake->hud.text_start_button;
-            has_button = true;
-        } else if (snake->state == SNAKE_STATE_RESUMING) {
-            title_text = snake->hud.text_resume_title;
-            subtitle_text = NULL;
-            has_subtitle = false;
-        } else {
-            title_text = snake->hud.text_game_over_title;
-            subtitle_text = snake->hud.text_game_over_score;
-            has_subtitle = true;
-            button_text = snake->hud.text_restart_button;
-            has_button = true;
-        }
-
-        snake_menu_layout_t layout;
-        if (snake->state == SNAKE_STATE_PAUSED) {
-            if (snake_menu_get_layout_with_three_buttons(snake, title_text, subtitle_text, has_subtitle, button_text,
-                                                         has_button, snake->hud.text_options_button, true,
-                                                         snake->hud.text_exit_button, true, &layout) == false) {
-                return;
-            }
-        } else if (snake->state == SNAKE_STATE_START) {
-            if (snake_menu_get_layout_with_secondary_button(snake, title_text, subtitle_text, has_subtitle, button_text,
-                                                            has_button, snake->hud.text_options_button, true,
-                                                            &layout) == false) {
-                return;
-            }
-        } else {
-            if (snake_menu_get_layout(snake, title_text, subtitle_text, has_subtitle, button_text, has_button,
-                                      &layout) == false) {
-                return;
-            }
-        }
-
-        if (SDL_SetRenderDrawBlendMode(snake->window.sdl_renderer, SDL_BLENDMODE_BLEND) == false) {
-            SDL_Log("Failed to set blend mode: %s", SDL_GetError());
-            snake->window.is_running = false;
-            return;
-        }
-
-        const Uint8 overlay_alpha = (Uint8)(k_color_menu_overlay.a * snake->hud.menu_fade_alpha);
-        SDL_SetRenderDrawColor(snake->window.sdl_renderer, k_color_menu_overlay.r, k_color_menu_overlay.g,
-                               k_color_menu_overlay.b, overlay_alpha);
-
-        SDL_FRect overlay_rect = {0.f, 0.f, (float)screen_size.x, (float)screen_size.y};
-        SDL_RenderFillRect(snake->window.sdl_renderer, &overlay_rect);
-
-        ui_panel_t panel;
-        ui_panel_init(&panel, k_color_menu_panel, k_color_menu_panel_border);
-        panel.rect = layout.panel_rect;
-        panel.fill_color.a = (Uint8)(k_color_menu_panel.a * snake->hud.menu_fade_alpha);
-        panel.border_color.a = (Uint8)(k_color_menu_panel_border.a * snake->hud.menu_fade_alpha);
-        if (ui_panel_render(snake->window.sdl_renderer, &panel) == false) {
-            SDL_Log("Failed to render menu panel: %s", SDL_GetError());
-            snake->window.is_running = false;
-            return;
-        }
-
-        ui_button_t button;
-        if (layout.has_button == true) {
-            ui_button_init(&button, k_color_menu_button, k_color_menu_button_border);
-            button.rect = layout.button_rect;
-            button.fill_color.a = (Uint8)(k_color_menu_button.a * snake->hud.menu_fade_alpha);
-            button.border_color.a = (Uint8)(k_color_menu_button_border.a * snake->hud.menu_fade_alpha);
-            if (ui_button_render(snake->window.sdl_renderer, &button) == false) {
-                SDL_Log("Failed to render menu button: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-        }
-
-        if (TTF_DrawRendererText(title_text, layout.title_pos.x, layout.title_pos.y) == false) {
-            SDL_Log("Failed to render menu title text: %s", SDL_GetError());
-            snake->window.is_running = false;
-            return;
-        }
-
-        if (snake->state == SNAKE_STATE_RESUMING && snake->hud.text_resume_countdown_texture != NULL) {
-            float countdown_x = (float)(screen_size.x - snake->hud.text_resume_countdown_size.x) * 0.5f;
-            float countdown_y = layout.title_pos.y + 60.f;
-            SDL_FRect dst = {countdown_x, countdown_y, (float)snake->hud.text_resume_countdown_size.x,
-                             (float)snake->hud.text_resume_countdown_size.y};
-            if (SDL_RenderTexture(snake->window.sdl_renderer, snake->hud.text_resume_countdown_texture, NULL, &dst) ==
-                false) {
-                SDL_Log("Failed to render resume countdown texture: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-        } else if (layout.has_subtitle == true) {
-            if (TTF_DrawRendererText(subtitle_text, layout.subtitle_pos.x, layout.subtitle_pos.y) == false) {
-                SDL_Log("Failed to render menu subtitle text: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-        }
-
-        if (layout.has_button == true) {
-            vector2i_t button_text_size;
-            if (snake_get_text_size(snake, button_text, &button_text_size, "menu button") == false) {
-                return;
-            }
-
-            float button_text_x = 0.f;
-            float button_text_y = 0.f;
-            ui_button_get_label_position(&button, &button_text_size, &button_text_x, &button_text_y);
-            if (TTF_DrawRendererText(button_text, button_text_x, button_text_y) == false) {
-                SDL_Log("Failed to render menu button text: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-        }
-
-        if (snake->state == SNAKE_STATE_PAUSED || snake->state == SNAKE_STATE_START) {
-            vector2i_t options_text_size;
-            if (snake_get_text_size(snake, snake->hud.text_options_button, &options_text_size, "options button") ==
-                false) {
-                return;
-            }
-
-            ui_button_t options_button;
-            ui_button_init(&options_button, k_color_menu_button, k_color_menu_button_border);
-            options_button.rect = layout.secondary_button_rect;
-            options_button.fill_color.a = (Uint8)(k_color_menu_button.a * snake->hud.menu_fade_alpha);
-            options_button.border_color.a = (Uint8)(k_color_menu_button_border.a * snake->hud.menu_fade_alpha);
-            if (ui_button_render(snake->window.sdl_renderer, &options_button) == false) {
-                SDL_Log("Failed to render options button: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-
-            float options_text_x = 0.f;
-            float options_text_y = 0.f;
-            ui_button_get_label_position(&options_button, &options_text_size, &options_text_x, &options_text_y);
-            if (TTF_DrawRendererText(snake->hud.text_options_button, options_text_x, options_text_y) == false) {
-                SDL_Log("Failed to render options button text: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-        }
-
-        if (snake->state == SNAKE_STATE_PAUSED) {
-            vector2i_t exit_text_size;
-            if (snake_get_text_size(snake, snake->hud.text_exit_button, &exit_text_size, "exit button") == false) {
-                return;
-            }
-
-            ui_button_t exit_button;
-            ui_button_init(&exit_button, k_color_menu_button, k_color_menu_button_border);
-            exit_button.rect = layout.tertiary_button_rect;
-            exit_button.fill_color.a = (Uint8)(k_color_menu_button.a * snake->hud.menu_fade_alpha);
-            exit_button.border_color.a = (Uint8)(k_color_menu_button_border.a * snake->hud.menu_fade_alpha);
-            if (ui_button_render(snake->window.sdl_renderer, &exit_button) == false) {
-                SDL_Log("Failed to render exit button: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-
-            float exit_text_x = 0.f;
-            float exit_text_y = 0.f;
-            ui_button_get_label_position(&exit_button, &exit_text_size, &exit_text_x, &exit_text_y);
-            if (TTF_DrawRendererText(snake->hud.text_exit_button, exit_text_x, exit_text_y) == false) {
-                SDL_Log("Failed to render exit button text: %s", SDL_GetError());
-                snake->window.is_running = false;
-                return;
-            }
-        }
-
-        if (SDL_SetRenderDrawBlendMode(snake->window.sdl_renderer, SDL_BLENDMODE_NONE) == false) {
-            SDL_Log("Failed to reset blend mode: %s", SDL_GetError());
-            snake->window.is_running = false;
+        if (render_menu_layer(snake, &screen_size) == false) {
             return;
         }
     }
@@ -319,7 +360,8 @@ void snake_render_frame(snake_t* snake) {
         SDL_RenderFillRect(snake->window.sdl_renderer, &overlay_rect);
 
         snake_options_layout_t options_layout;
-        if (snake_options_layout_get(snake, &options_layout) == false) {
+        if (snake_menu_update_ui(snake) == false || snake_options_layout_get(snake, &options_layout) == false) {
+            snake->window.is_running = false;
             return;
         }
 
@@ -364,9 +406,12 @@ void snake_render_frame(snake_t* snake) {
             return;
         }
 
-        if (TTF_DrawRendererText(snake->hud.text_options_volume_value, options_layout.volume_value_pos.x,
-                                 options_layout.volume_value_pos.y) == false) {
-            SDL_Log("Failed to render volume value text: %s", SDL_GetError());
+        SDL_FColor value_color = k_color_text;
+        value_color.a *= snake->hud.menu_fade_alpha;
+        if (glyph_atlas_draw(&snake->hud.glyphs, snake->window.sdl_renderer,
+                             snake->hud.text_options_volume_value_buffer, options_layout.volume_value_pos.x,
+                             options_layout.volume_value_pos.y, value_color) == false) {
+            SDL_Log("Failed to render volume value text");
             snake->window.is_running = false;
             return;
         }
@@ -419,14 +464,15 @@ void snake_render_frame(snake_t* snake) {
             return;
         }
 
-        if (TTF_DrawRendererText(snake->hud.text_options_resume_value, options_layout.resume_value_pos.x,
-                                 options_layout.resume_value_pos.y) == false) {
-            SDL_Log("Failed to render resume value text: %s", SDL_GetError());
+        if (glyph_atlas_draw(&snake->hud.glyphs, snake->window.sdl_renderer,
+                             snake->hud.text_options_resume_value_buffer, options_layout.resume_value_pos.x,
+                             options_layout.resume_value_pos.y, value_color) == false) {
+            SDL_Log("Failed to render resume value text");
             snake->window.is_running = false;
             return;
         }
 
-        options_layout.back_button.fill_color = k_color_menu_button;
+        options_layout.back_button.fill_color = get_button_color(snake, SNAKE_UI_BACK_BUTTON);
         options_layout.back_button.border_color = k_color_menu_button_border;
         options_layout.back_button.fill_color.a = (Uint8)(k_color_menu_button.a * snake->hud.menu_fade_alpha);
         options_layout.back_button.border_color.a = (Uint8)(k_color_menu_button_border.a * snake->hud.menu_fade_alpha);
@@ -450,5 +496,11 @@ void snake_render_frame(snake_t* snake) {
         }
     }
 
+    if (snake->show_latency_overlay == true && snake_latency_overlay_render(snake) == false) {
+        return;
+    }
+
     SDL_RenderPresent(snake->window.sdl_renderer);
+    // Event timestamps are on the SDL_GetTicksNS() clock too.
+    snake_latency_record_present(&snake->latency, SDL_GetTicksNS());
 }
@@ -6,7 +6,7 @@
 #include "../snake.h"
 
 bool snake_state_reset(snake_t* snake);
-void snake_state_handle_movement_key(snake_t* snake, SDL_Scancode scancode);
+void snake_state_handle_movement_key(snake_t* snake, SDL_Scancode scancode, Uint64 timestamp_ns);
 void snake_state_begin_resume(snake_t* snake);
 void snake_state_begin_options(snake_t* snake, snake_game_state_t return_state);
 
@@ -2,10 +2,88 @@
 #include <SDL3/SDL_log.h>
 
 #include "snake.h"
+#include "snake_headless.h"
+
+static const Uint64 k_headless_default_seed = 1;
+
+/**
+ * @brief Read the unsigned decimal number an option is followed by.
+ *
+ * @param text The argument after the option, or NULL if the option was last.
+ * @return false, after logging why, if text is missing, not entirely digits or does not fit in a Uint64.
+ */
+static bool parse_option_value(const char* option, const char* text, Uint64* out_value) {
+    if (text == NULL) {
+        SDL_Log("Missing value for %s", option);
+        return false;
+    }
+
+    // Parsed by hand: SDL_strtoull() would also take leading spaces and a sign, and saturates on overflow.
+    Uint64 value = 0;
+    const char* c = text;
+    do {
+        if (SDL_isdigit((unsigned char)*c) == 0 || value > (SDL_MAX_UINT64 - (Uint64)(*c - '0')) / 10) {
+            SDL_Log("Invalid value for %s: '%s'", option, text);
+            return false;
+        }
+        value = value * 10 + (Uint64)(*c - '0');
+    } while (*++c != '\0');
+
+    *out_value = value;
+    return true;
+}
+
+/**
+ * @brief Read "--headless <ticks> [--seed <n>]" from the command line.
+ *
+ * @param out_headless Set to true if a headless run was requested; out_options then holds its settings.
+ * @return false, after logging the usage, if an option is missing its value, the value is not a number, or --seed
+ *         is given without --headless.
+ */
+static bool parse_headless_options(int argc, char* argv[], snake_headless_options_t* out_options, bool* out_headless) {
+    *out_headless = false;
+    out_options->tick_count = 0;
+    out_options->seed = k_headless_default_seed;
+    bool has_seed = false;
+
+    for (int i = 1; i < argc; ++i) {
+        Uint64* value = NULL;
+        if (SDL_strcmp(argv[i], "--headless") == 0) {
+            *out_headless = true;
+            value = &out_options->tick_count;
+        } else if (SDL_strcmp(argv[i], "--seed") == 0) {
+            has_seed = true;
+            value = &out_options->seed;
+        } else {
+            continue;
+        }
+
+        const char* const text = i + 1 < argc ? argv[i + 1] : NULL;
+        if (parse_option_value(argv[i], text, value) == false) {
+            SDL_Log("Usage: %s [--headless <ticks> [--seed <n>]]", argv[0]);
+            return false;
+        }
+        ++i;
+    }
+
+    if (has_seed == true && *out_headless == false) {
+        SDL_Log("--seed only applies to --headless runs");
+        SDL_Log("Usage: %s [--headless <ticks> [--seed <n>]]", argv[0]);
+        return false;
+    }
+
+    return true;
+}
 
 int main(int argc, char* argv[]) {
-    (void)argc;
-    (void)argv;
+    snake_headless_options_t headless_options;
+    bool headless = false;
+    if (parse_headless_options(argc, argv, &headless_options, &headless) == false) {
+        return 1;
+    }
+    if (headless == true) {
+        return snake_headless_run(&headless_options) == true ? 0 : 1;
+    }
 
     SDL_Log("Starting snake game");
 
@@ -16,9 +94,15 @@ int main(int argc, char* argv[]) {
     }
 
     while (snake.window.is_running == true) {
+        // Nothing moves on an idle menu, so sleep until there is input to react to.
+        if (snake_is_animating(&snake) == false && frame_pacer_wait_for_event(&snake.pacer) == true) {
+            window_reset_fixed(&snake.window);
+        }
+
         snake_handle_events(&snake);
-        while (snake.window.is_running == true &&
-               window_can_update_fixed(&snake.window, WINDOW_TICK_INTERVAL) == true) {
+        snake_poll_assets(&snake);
+        const int ticks = window_begin_frame(&snake.window);
+        for (int i = 0; i < ticks && snake.window.is_running == true; ++i) {
             snake_update_fixed(&snake);
         }
 
@@ -27,6 +111,7 @@ int main(int argc, char* argv[]) {
         }
 
         snake_render_frame(&snake);
+        frame_pacer_end_frame(&snake.pacer);
     }
 
     SDL_Log("Game shutting down");
@@ -0,0 +1,105 @@
+#include "asset_loader.h"
+
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_log.h>
+
+static int run_job(void* data) {
+    asset_job_t* const job = (asset_job_t*)data;
+
+    const bool success = job->fn(job->user_data);
+    SDL_SetAtomicInt(&job->status, success == true ? ASSET_JOB_SUCCEEDED : ASSET_JOB_FAILED);
+    return 0;
+}
+
+/**
+ * @brief Join a finished job's thread and mark it collected.
+ */
+static bool collect(asset_job_t* job) {
+    if (job->thread != NULL) {
+        SDL_WaitThread(job->thread, NULL);
+        job->thread = NULL;
+    }
+    job->is_collected = true;
+    return SDL_GetAtomicInt(&job->status) == ASSET_JOB_SUCCEEDED;
+}
+
+void asset_loader_init(asset_loader_t* loader) {
+    SDL_assert(loader != NULL);
+
+    memset(loader, 0, sizeof(*loader));
+}
+
+void asset_loader_destroy(asset_loader_t* loader) {
+    SDL_assert(loader != NULL);
+
+    for (int i = 0; i < loader->job_count; ++i) {
+        if (loader->jobs[i].is_collected == false) {
+            collect(&loader->jobs[i]);
+        }
+    }
+    loader->job_count = 0;
+}
+
+int asset_loader_start(asset_loader_t* loader, asset_load_fn_t fn, void* user_data, const char* name) {
+    SDL_assert(loader != NULL);
+    SDL_assert(fn != NULL);
+    SDL_assert(name != NULL);
+
+    if (loader->job_count == ASSET_LOADER_MAX_JOBS) {
+        SDL_Log("Too many asset loads at once, cannot start '%s'", name);
+        return -1;
+    }
+
+    const int id = loader->job_count;
+    asset_job_t* const job = &loader->jobs[id];
+    job->fn = fn;
+    job->user_data = user_data;
+    job->is_collected = false;
+    SDL_SetAtomicInt(&job->status, ASSET_JOB_RUNNING);
+    loader->job_count++;
+
+    job->thread = SDL_CreateThread(run_job, name, job);
+    if (job->thread == NULL) {
+        SDL_Log("Failed to start loader thread '%s', loading it now instead: %s", name, SDL_GetError());
+        run_job(job);
+    }
+
+    return id;
+}
+
+bool asset_loader_wait(asset_loader_t* loader, int job) {
+    SDL_assert(loader != NULL);
+    SDL_assert(job >= 0 && job < loader->job_count);
+
+    if (loader->jobs[job].is_collected == true) {
+        return false;
+    }
+    return collect(&loader->jobs[job]);
+}
+
+int asset_loader_poll(asset_loader_t* loader, bool* out_success) {
+    SDL_assert(loader != NULL);
+    SDL_assert(out_success != NULL);
+
+    for (int i = 0; i < loader->job_count; ++i) {
+        asset_job_t* const job = &loader->jobs[i];
+        if (job->is_collected == false && SDL_GetAtomicInt(&job->status) != ASSET_JOB_RUNNING) {
+            *out_success = collect(job);
+            return i;
+        }
+    }
+
+    return -1;
+}
+
+bool asset_loader_is_idle(const asset_loader_t* loader) {
+    SDL_assert(loader != NULL);
+
+    for (int i = 0; i < loader->job_count; ++i) {
+        if (loader->jobs[i].is_collected == false) {
+            return false;
+        }
+    }
+    return true;
+}
@@ -0,0 +1,83 @@
+#ifndef ASSET_LOADER_H
+#define ASSET_LOADER_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_thread.h>
+
+/* Jobs one loader holds over its lifetime; startup only loads a few assets. */
+#define ASSET_LOADER_MAX_JOBS 8
+
+/**
+ * @brief Load one asset, e.g. read and decode a file, writing the result somewhere user_data points to.
+ *
+ * Runs on a worker thread, so it must only touch its own user_data and thread-safe functions (file I/O, decoding,
+ * audio conversion), never the renderer, the window or other SDL state owned by the main thread.
+ *
+ * @return false if loading failed.
+ */
+typedef bool (*asset_load_fn_t)(void* user_data);
+
+typedef enum { ASSET_JOB_RUNNING, ASSET_JOB_SUCCEEDED, ASSET_JOB_FAILED } asset_job_status_t;
+
+typedef struct {
+    asset_load_fn_t fn;
+    void* user_data;
+    SDL_Thread* thread;
+    /* An asset_job_status_t, published by the worker once fn returned, so its results are visible by then. */
+    SDL_AtomicInt status;
+    /* The main thread has joined the worker and taken the result. */
+    bool is_collected;
+} asset_job_t;
+
+/**
+ * @brief Runs asset loads on worker threads while the main thread gets on with creating the window and renderer.
+ *
+ * Each job gets its own thread, since startup loads are few and mostly wait on the disk. The main thread learns about
+ * finished jobs by polling (asset_loader_poll(), e.g. once a frame) or by blocking on the one it cannot go on without
+ * (asset_loader_wait()). Results are handed over through the job's user_data, which must stay alive and untouched by
+ * the main thread until the job is collected.
+ */
+typedef struct {
+    asset_job_t jobs[ASSET_LOADER_MAX_JOBS];
+    int job_count;
+} asset_loader_t;
+
+void asset_loader_init(asset_loader_t* loader);
+
+/**
+ * @brief Wait for every job still running, discarding their status. Results already written stay with their owners.
+ */
+void asset_loader_destroy(asset_loader_t* loader);
+
+/**
+ * @brief Start loading an asset in the background.
+ *
+ * If no thread can be started the load runs right away on the calling thread instead, so a job always completes.
+ *
+ * @param name Thread name, for debuggers.
+ * @return Id of the job, or -1 if the loader already holds ASSET_LOADER_MAX_JOBS jobs.
+ */
+int asset_loader_start(asset_loader_t* loader, asset_load_fn_t fn, void* user_data, const char* name);
+
+/**
+ * @brief Block until a job finishes and collect it.
+ *
+ * @return true if the job succeeded. A job can only be collected once; collecting it again returns false.
+ */
+bool asset_loader_wait(asset_loader_t* loader, int job);
+
+/**
+ * @brief Collect one finished job without blocking.
+ *
+ * @param out_success Receives whether the collected job succeeded.
+ * @return Id of the collected job, or -1 if no uncollected job has finished.
+ */
+int asset_loader_poll(asset_loader_t* loader, bool* out_success);
+
+/**
+ * @brief Whether every job started so far has been collected.
+ */
+bool asset_loader_is_idle(const asset_loader_t* loader);
+
+#endif  // ASSET_LOADER_H
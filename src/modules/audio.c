@@ -30,6 +30,27 @@ static bool apply_gain(audio_manager_t* manager) {
     return true;
 }
 
+/**
+ * @brief Device callback: mix as many frames as the device still needs and hand them to the stream.
+ *
+ * SDL calls it with the stream locked, so it never runs concurrently with audio_manager_play_sound().
+ */
+static void SDLCALL mix_into_stream(void* userdata, SDL_AudioStream* stream, int additional_amount, int total_amount) {
+    audio_manager_t* const manager = (audio_manager_t*)userdata;
+    (void)total_amount;
+
+    const int frame_size = (int)sizeof(float) * AUDIO_CHANNELS;
+    int frames_needed = (additional_amount + frame_size - 1) / frame_size;
+    while (frames_needed > 0) {
+        const int frames = SDL_min(frames_needed, AUDIO_MIX_CHUNK_FRAMES);
+        audio_mixer_mix(&manager->mixer, manager->mix_buffer, frames);
+        if (SDL_PutAudioStreamData(stream, manager->mix_buffer, frames * frame_size) == false) {
+            return;
+        }
+        frames_needed -= frames;
+    }
+}
+
 bool audio_manager_create(audio_manager_t* manager) {
     SDL_assert(manager != NULL);
 
@@ -40,9 +61,10 @@ bool audio_manager_create(audio_manager_t* manager) {
         return false;
     }
 
-    const SDL_AudioSpec spec = {.format = SDL_AUDIO_F32, .channels = 2, .freq = 44100};
+    const SDL_AudioSpec spec = {.format = SDL_AUDIO_F32, .channels = AUDIO_CHANNELS, .freq = AUDIO_FREQUENCY};
+    audio_mixer_init(&manager->mixer, AUDIO_CHANNELS);
 
-    manager->stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, NULL, NULL);
+    manager->stream = SDL_OpenAudioDeviceStream(SDL_AUDIO_DEVICE_DEFAULT_PLAYBACK, &spec, mix_into_stream, manager);
     if (manager->stream == NULL) {
         SDL_Log("Failed to open audio device stream: %s", SDL_GetError());
         SDL_QuitSubSystem(SDL_INIT_AUDIO);
@@ -77,6 +99,13 @@ void audio_manager_destroy(audio_manager_t* manager) {
         return;
     }
 
+    // Stop the device callback before freeing the sounds its voices read from.
+    if (manager->stream != NULL) {
+        SDL_DestroyAudioStream(manager->stream);
+        manager->stream = NULL;
+    }
+    audio_mixer_stop_all(&manager->mixer);
+
     for (size_t i = 0; i < SOUND_COUNT; ++i) {
         if (manager->sounds[i].buffer != NULL) {
             SDL_free(manager->sounds[i].buffer);
@@ -85,34 +114,17 @@ void audio_manager_destroy(audio_manager_t* manager) {
         manager->sounds[i].length = 0;
     }
 
-    if (manager->stream != NULL) {
-        SDL_DestroyAudioStream(manager->stream);
-        manager->stream = NULL;
-    }
-
     SDL_QuitSubSystem(SDL_INIT_AUDIO);
 
     manager->is_initialized = false;
 }
 
-bool audio_manager_load_sound(audio_manager_t* manager, sound_id_t id, const char* filepath) {
-    SDL_assert(manager != NULL);
+bool audio_decode_sound(const char* filepath, sound_data_t* out_sound) {
     SDL_assert(filepath != NULL);
+    SDL_assert(out_sound != NULL);
 
-    if (manager->is_initialized == false) {
-        SDL_Log("Audio manager not initialized, cannot load sound: %s", filepath);
-        return false;
-    }
-
-    if (id >= SOUND_COUNT) {
-        SDL_Log("Invalid sound ID: %d", id);
-        return false;
-    }
-
-    if (manager->sounds[id].buffer != NULL) {
-        SDL_Log("Sound already loaded for ID %d, skipping: %s", id, filepath);
-        return true;
-    }
+    out_sound->buffer = NULL;
+    out_sound->length = 0;
 
     SDL_AudioSpec spec;
     uint8_t* buffer = NULL;
@@ -123,13 +135,8 @@ bool audio_manager_load_sound(audio_manager_t* manager, sound_id_t id, const cha
         return false;
     }
 
-    SDL_AudioSpec target_spec;
-    if (SDL_GetAudioStreamFormat(manager->stream, &target_spec, NULL) == false) {
-        SDL_Log("Failed to get audio stream format: %s", SDL_GetError());
-        SDL_free(buffer);
-        return false;
-    }
-
+    // The mixer reads sounds in the layout audio_manager_create() opens the stream with.
+    const SDL_AudioSpec target_spec = {.format = SDL_AUDIO_F32, .channels = AUDIO_CHANNELS, .freq = AUDIO_FREQUENCY};
     uint8_t* converted_buffer = NULL;
     int converted_length = 0;
 
@@ -142,11 +149,29 @@ bool audio_manager_load_sound(audio_manager_t* manager, sound_id_t id, const cha
 
     SDL_free(buffer);
 
-    manager->sounds[id].buffer = converted_buffer;
-    manager->sounds[id].length = (size_t)converted_length;
-    manager->sounds[id].spec = target_spec;
+    out_sound->buffer = converted_buffer;
+    out_sound->length = (size_t)converted_length;
+    out_sound->spec = target_spec;
+    return true;
+}
+
+bool audio_manager_set_sound(audio_manager_t* manager, sound_id_t id, sound_data_t* sound) {
+    SDL_assert(manager != NULL);
+    SDL_assert(sound != NULL);
+    SDL_assert(sound->buffer != NULL);
 
-    SDL_Log("Successfully loaded sound: %s (ID: %d, %d bytes)", filepath, id, converted_length);
+    if (manager->is_initialized == false || id >= SOUND_COUNT || manager->sounds[id].buffer != NULL) {
+        SDL_Log("Cannot set sound for ID %d, discarding it", id);
+        SDL_free(sound->buffer);
+        sound->buffer = NULL;
+        sound->length = 0;
+        return false;
+    }
+
+    SDL_assert(sound->spec.format == SDL_AUDIO_F32 && sound->spec.channels == AUDIO_CHANNELS);
+    manager->sounds[id] = *sound;
+    sound->buffer = NULL;
+    sound->length = 0;
     return true;
 }
 
@@ -167,11 +192,14 @@ bool audio_manager_play_sound(audio_manager_t* manager, sound_id_t id) {
         return false;
     }
 
-    if (SDL_PutAudioStreamData(manager->stream, manager->sounds[id].buffer, (int)manager->sounds[id].length) ==
-        false) {
-        SDL_Log("Failed to queue audio data for playback: %s", SDL_GetError());
+    const sound_data_t* const sound = &manager->sounds[id];
+    const int frame_count = (int)(sound->length / (sizeof(float) * (size_t)sound->spec.channels));
+    if (SDL_LockAudioStream(manager->stream) == false) {
+        SDL_Log("Failed to lock audio stream for playback: %s", SDL_GetError());
         return false;
     }
+    audio_mixer_play(&manager->mixer, (const float*)sound->buffer, frame_count, 1.0f);
+    SDL_UnlockAudioStream(manager->stream);
 
     return true;
 }
@@ -5,6 +5,15 @@
 #include <stddef.h>
 #include <SDL3/SDL_audio.h>
 
+#include "audio_mixer.h"
+
+/* Output is interleaved stereo float; loaded sounds are converted to match. */
+#define AUDIO_CHANNELS 2
+#define AUDIO_FREQUENCY 44100
+
+/* Frames mixed per pass of the device callback, which loops for larger requests. */
+#define AUDIO_MIX_CHUNK_FRAMES 512
+
 typedef enum {
     SOUND_EAT_FOOD,
     SOUND_COUNT  // Must be last
@@ -16,9 +25,19 @@ typedef struct {
     SDL_AudioSpec spec;
 } sound_data_t;
 
+/**
+ * @brief Sound effects played through a mixer that the audio device pulls from.
+ *
+ * audio_manager_play_sound() only starts a voice; samples are produced in the device callback as the device asks for
+ * them, so a sound is heard within one device buffer however many were started before it.
+ */
 typedef struct {
     SDL_AudioStream* stream;
     sound_data_t sounds[SOUND_COUNT];
+    /* Shared with the device callback; only touched with the stream locked once the device runs. */
+    audio_mixer_t mixer;
+    /* Only used by the device callback. */
+    float mix_buffer[AUDIO_MIX_CHUNK_FRAMES * AUDIO_CHANNELS];
     bool is_initialized;
     bool is_muted;
     float volume;
@@ -27,7 +46,24 @@ typedef struct {
 bool audio_manager_create(audio_manager_t* manager);
 void audio_manager_destroy(audio_manager_t* manager);
 
-bool audio_manager_load_sound(audio_manager_t* manager, sound_id_t id, const char* filepath);
+/**
+ * @brief Decode a WAV file and convert it to the layout sounds are mixed in.
+ *
+ * Touches no audio manager or device, so it can run on a worker thread while the main thread opens the device.
+ *
+ * @param out_sound Receives the samples, allocated with SDL_malloc(); hand them to audio_manager_set_sound() or
+ *                  SDL_free() them.
+ * @return false if the file could not be read or converted.
+ */
+bool audio_decode_sound(const char* filepath, sound_data_t* out_sound);
+
+/**
+ * @brief Take ownership of a decoded sound and make it playable under id.
+ *
+ * sound is left empty either way; on failure (no audio, an invalid id, or id already loaded) its samples are freed.
+ */
+bool audio_manager_set_sound(audio_manager_t* manager, sound_id_t id, sound_data_t* sound);
+
 bool audio_manager_play_sound(audio_manager_t* manager, sound_id_t id);
 bool audio_manager_set_volume(audio_manager_t* manager, float volume);
 bool audio_manager_set_muted(audio_manager_t* manager, bool muted);
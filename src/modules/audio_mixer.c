@@ -0,0 +1,107 @@
+#include "audio_mixer.h"
+
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_intrin.h>
+
+/**
+ * @brief dst[i] += src[i] * gain, four samples at a time where the target has vector instructions.
+ */
+static void mix_samples(float* dst, const float* src, int count, float gain) {
+    int i = 0;
+#if defined(SDL_SSE_INTRINSICS)
+    const __m128 gain4 = _mm_set1_ps(gain);
+    for (; i + 4 <= count; i += 4) {
+        const __m128 mixed = _mm_add_ps(_mm_loadu_ps(dst + i), _mm_mul_ps(_mm_loadu_ps(src + i), gain4));
+        _mm_storeu_ps(dst + i, mixed);
+    }
+#elif defined(SDL_NEON_INTRINSICS)
+    for (; i + 4 <= count; i += 4) {
+        vst1q_f32(dst + i, vmlaq_n_f32(vld1q_f32(dst + i), vld1q_f32(src + i), gain));
+    }
+#endif
+    for (; i < count; ++i) {
+        dst[i] += src[i] * gain;
+    }
+}
+
+void audio_mixer_init(audio_mixer_t* mixer, int channels) {
+    SDL_assert(mixer != NULL);
+    SDL_assert(channels >= 1);
+
+    memset(mixer, 0, sizeof(*mixer));
+    mixer->channels = channels;
+}
+
+int audio_mixer_play(audio_mixer_t* mixer, const float* samples, int frame_count, float gain) {
+    SDL_assert(mixer != NULL);
+    SDL_assert(samples != NULL);
+    SDL_assert(frame_count >= 0);
+
+    int chosen = 0;
+    for (int i = 0; i < AUDIO_MIXER_VOICE_COUNT; ++i) {
+        const audio_mixer_voice_t* const voice = &mixer->voices[i];
+        if (voice->is_active == false) {
+            chosen = i;
+            break;
+        }
+        if (voice->start_order < mixer->voices[chosen].start_order) {
+            chosen = i;
+        }
+    }
+
+    audio_mixer_voice_t* const voice = &mixer->voices[chosen];
+    voice->samples = samples;
+    voice->frame_count = frame_count;
+    voice->position = 0;
+    voice->gain = gain;
+    voice->start_order = mixer->next_start_order++;
+    voice->is_active = true;
+    return chosen;
+}
+
+void audio_mixer_stop_all(audio_mixer_t* mixer) {
+    SDL_assert(mixer != NULL);
+
+    for (int i = 0; i < AUDIO_MIXER_VOICE_COUNT; ++i) {
+        mixer->voices[i].is_active = false;
+        mixer->voices[i].samples = NULL;
+    }
+}
+
+int audio_mixer_get_active_count(const audio_mixer_t* mixer) {
+    SDL_assert(mixer != NULL);
+
+    int count = 0;
+    for (int i = 0; i < AUDIO_MIXER_VOICE_COUNT; ++i) {
+        if (mixer->voices[i].is_active == true) {
+            count++;
+        }
+    }
+    return count;
+}
+
+void audio_mixer_mix(audio_mixer_t* mixer, float* out, int frame_count) {
+    SDL_assert(mixer != NULL);
+    SDL_assert(out != NULL);
+    SDL_assert(frame_count >= 0);
+
+    const int channels = mixer->channels;
+    memset(out, 0, sizeof(float) * (size_t)frame_count * (size_t)channels);
+
+    for (int i = 0; i < AUDIO_MIXER_VOICE_COUNT; ++i) {
+        audio_mixer_voice_t* const voice = &mixer->voices[i];
+        if (voice->is_active == false) {
+            continue;
+        }
+
+        const int frames = SDL_min(frame_count, voice->frame_count - voice->position);
+        mix_samples(out, voice->samples + (size_t)voice->position * (size_t)channels, frames * channels, voice->gain);
+        voice->position += frames;
+
+        if (voice->position >= voice->frame_count) {
+            voice->is_active = false;
+            voice->samples = NULL;
+        }
+    }
+}
@@ -0,0 +1,67 @@
+#ifndef AUDIO_MIXER_H
+#define AUDIO_MIXER_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_stdinc.h>
+
+/* Sounds that can play at once. Starting another one cuts off the oldest. */
+#define AUDIO_MIXER_VOICE_COUNT 8
+
+typedef struct {
+    /* Interleaved float samples, owned by whoever started the voice and kept alive while it plays. */
+    const float* samples;
+    int frame_count;
+    /* Next frame to mix. */
+    int position;
+    float gain;
+    /* When the voice was started, counting plays; the lowest is stolen first. */
+    Uint64 start_order;
+    bool is_active;
+} audio_mixer_voice_t;
+
+/**
+ * @brief Fixed pool of voices summed into interleaved float buffers.
+ *
+ * Meant to be driven from the audio device's callback, so a sound starts in the next buffer the device asks for
+ * instead of queuing behind everything already played. Sounds overlap rather than wait for one another, and when
+ * every voice is busy the one that has played longest is cut off, so a burst of events never builds up a backlog.
+ *
+ * Not thread-safe: callers serialize audio_mixer_play() against audio_mixer_mix(), e.g. with the audio stream lock.
+ * Fixed size and allocation-free.
+ */
+typedef struct {
+    audio_mixer_voice_t voices[AUDIO_MIXER_VOICE_COUNT];
+    int channels;
+    Uint64 next_start_order;
+} audio_mixer_t;
+
+/**
+ * @param channels Interleaved channels in both the sounds and the mixed output, at least 1.
+ */
+void audio_mixer_init(audio_mixer_t* mixer, int channels);
+
+/**
+ * @brief Start a sound on a free voice, or on the oldest one if none is free.
+ *
+ * @param samples Interleaved samples in the mixer's channel layout.
+ * @param frame_count Frames in samples, i.e. samples per channel.
+ * @param gain Factor applied to this voice alone, usually in [0, 1].
+ * @return Index of the voice used.
+ */
+int audio_mixer_play(audio_mixer_t* mixer, const float* samples, int frame_count, float gain);
+
+/**
+ * @brief Silence every voice, e.g. before the sounds they read from are freed.
+ */
+void audio_mixer_stop_all(audio_mixer_t* mixer);
+
+int audio_mixer_get_active_count(const audio_mixer_t* mixer);
+
+/**
+ * @brief Overwrite out with the next frame_count frames of every active voice summed, and retire finished voices.
+ *
+ * Output is not clipped; values past [-1, 1] are left for the device conversion to clamp.
+ */
+void audio_mixer_mix(audio_mixer_t* mixer, float* out, int frame_count);
+
+#endif  // AUDIO_MIXER_H
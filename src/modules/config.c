@@ -10,6 +10,12 @@
 
 static const char* k_config_filename = "config.ini";
 
+/* Indexed by snake_speed_curve_t. */
+static const char* const k_speed_curve_names[] = {"constant", "linear", "stepped"};
+
+SDL_COMPILE_TIME_ASSERT(config_speed_curve_names,
+                        SDL_arraysize(k_speed_curve_names) == SNAKE_SPEED_CURVE_STEPPED + 1);
+
 void config_normalize(game_config_t* config) {
     SDL_assert(config != NULL);
 
@@ -24,6 +30,48 @@ void config_normalize(game_config_t* config) {
     } else if (config->resume_delay_seconds > CONFIG_RESUME_DELAY_MAX) {
         config->resume_delay_seconds = CONFIG_RESUME_DELAY_MAX;
     }
+
+    if (config->grid_width < CONFIG_GRID_SIZE_MIN) {
+        config->grid_width = CONFIG_GRID_SIZE_MIN;
+    } else if (config->grid_width > CONFIG_GRID_SIZE_MAX) {
+        config->grid_width = CONFIG_GRID_SIZE_MAX;
+    }
+
+    if (config->grid_height < CONFIG_GRID_SIZE_MIN) {
+        config->grid_height = CONFIG_GRID_SIZE_MIN;
+    } else if (config->grid_height > CONFIG_GRID_SIZE_MAX) {
+        config->grid_height = CONFIG_GRID_SIZE_MAX;
+    }
+
+    if (config->fps_cap < 0) {
+        config->fps_cap = 0;
+    } else if (config->fps_cap > 0 && config->fps_cap < CONFIG_FPS_CAP_MIN) {
+        config->fps_cap = CONFIG_FPS_CAP_MIN;
+    } else if (config->fps_cap > CONFIG_FPS_CAP_MAX) {
+        config->fps_cap = CONFIG_FPS_CAP_MAX;
+    }
+
+    if (config->tick_rate < SNAKE_SPEED_RATE_MIN) {
+        config->tick_rate = SNAKE_SPEED_RATE_MIN;
+    } else if (config->tick_rate > SNAKE_SPEED_RATE_MAX) {
+        config->tick_rate = SNAKE_SPEED_RATE_MAX;
+    }
+
+    if (config->tick_rate_max < config->tick_rate) {
+        config->tick_rate_max = config->tick_rate;
+    } else if (config->tick_rate_max > SNAKE_SPEED_RATE_MAX) {
+        config->tick_rate_max = SNAKE_SPEED_RATE_MAX;
+    }
+
+    if (config->speed_curve < SNAKE_SPEED_CURVE_CONSTANT || config->speed_curve > SNAKE_SPEED_CURVE_STEPPED) {
+        config->speed_curve = SNAKE_SPEED_CURVE_CONSTANT;
+    }
+
+    if (config->speed_step < SNAKE_SPEED_STEP_MIN) {
+        config->speed_step = SNAKE_SPEED_STEP_MIN;
+    } else if (config->speed_step > SNAKE_SPEED_STEP_MAX) {
+        config->speed_step = SNAKE_SPEED_STEP_MAX;
+    }
 }
 
 void config_set_defaults(game_config_t* config) {
@@ -33,6 +81,15 @@ void config_set_defaults(game_config_t* config) {
     config->mute = false;
     config->volume = 1.0f;
     config->resume_delay_seconds = CONFIG_RESUME_DELAY_DEFAULT;
+    config->grid_width = CONFIG_GRID_SIZE_DEFAULT;
+    config->grid_height = CONFIG_GRID_SIZE_DEFAULT;
+    config->fullscreen = false;
+    config->vsync = true;
+    config->fps_cap = CONFIG_FPS_CAP_DEFAULT;
+    config->tick_rate = SNAKE_SPEED_RATE_DEFAULT;
+    config->tick_rate_max = SNAKE_SPEED_RATE_DEFAULT;
+    config->speed_curve = SNAKE_SPEED_CURVE_CONSTANT;
+    config->speed_step = SNAKE_SPEED_STEP_DEFAULT;
 }
 
 static bool config_build_path_from_base(const char* base_path, char* out_path, size_t path_size) {
@@ -100,6 +157,20 @@ static bool config_parse_bool(const char* value, bool* out_value) {
     return false;
 }
 
+static bool config_parse_speed_curve(const char* value, snake_speed_curve_t* out_value) {
+    SDL_assert(value != NULL);
+    SDL_assert(out_value != NULL);
+
+    for (size_t i = 0; i < SDL_arraysize(k_speed_curve_names); ++i) {
+        if (SDL_strcasecmp(value, k_speed_curve_names[i]) == 0) {
+            *out_value = (snake_speed_curve_t)i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
 static bool config_parse_float(const char* value, float* out_value) {
     SDL_assert(value != NULL);
     SDL_assert(out_value != NULL);
@@ -212,6 +283,73 @@ bool config_parse_buffer(const char* contents, game_config_t* config, bool* out_
                     return false;
                 }
                 parsed_config.resume_delay_seconds = (int)parsed;
+            } else if (SDL_strcasecmp(key, "grid_width") == 0 || SDL_strcasecmp(key, "grid_height") == 0) {
+                size_t parsed = 0;
+                if (config_parse_size(value, &parsed) == false) {
+                    SDL_Log("Invalid %s value: %s", key, value);
+                    *out_invalid = true;
+                    return false;
+                }
+                /* Out-of-range sizes are clamped by config_normalize(); only keep them from overflowing int here. */
+                const int size = parsed > CONFIG_GRID_SIZE_MAX ? CONFIG_GRID_SIZE_MAX + 1 : (int)parsed;
+                if (SDL_strcasecmp(key, "grid_width") == 0) {
+                    parsed_config.grid_width = size;
+                } else {
+                    parsed_config.grid_height = size;
+                }
+            } else if (SDL_strcasecmp(key, "fullscreen") == 0) {
+                bool parsed = false;
+                if (config_parse_bool(value, &parsed) == false) {
+                    SDL_Log("Invalid fullscreen value: %s", value);
+                    *out_invalid = true;
+                    return false;
+                }
+                parsed_config.fullscreen = parsed;
+            } else if (SDL_strcasecmp(key, "vsync") == 0) {
+                bool parsed = false;
+                if (config_parse_bool(value, &parsed) == false) {
+                    SDL_Log("Invalid vsync value: %s", value);
+                    *out_invalid = true;
+                    return false;
+                }
+                parsed_config.vsync = parsed;
+            } else if (SDL_strcasecmp(key, "fps_cap") == 0) {
+                size_t parsed = 0;
+                if (config_parse_size(value, &parsed) == false) {
+                    SDL_Log("Invalid fps_cap value: %s", value);
+                    *out_invalid = true;
+                    return false;
+                }
+                parsed_config.fps_cap = parsed > CONFIG_FPS_CAP_MAX ? CONFIG_FPS_CAP_MAX + 1 : (int)parsed;
+            } else if (SDL_strcasecmp(key, "tick_rate") == 0 || SDL_strcasecmp(key, "tick_rate_max") == 0) {
+                size_t parsed = 0;
+                if (config_parse_size(value, &parsed) == false) {
+                    SDL_Log("Invalid %s value: %s", key, value);
+                    *out_invalid = true;
+                    return false;
+                }
+                const int rate = parsed > SNAKE_SPEED_RATE_MAX ? SNAKE_SPEED_RATE_MAX + 1 : (int)parsed;
+                if (SDL_strcasecmp(key, "tick_rate") == 0) {
+                    parsed_config.tick_rate = rate;
+                } else {
+                    parsed_config.tick_rate_max = rate;
+                }
+            } else if (SDL_strcasecmp(key, "speed_curve") == 0) {
+                snake_speed_curve_t parsed = SNAKE_SPEED_CURVE_CONSTANT;
+                if (config_parse_speed_curve(value, &parsed) == false) {
+                    SDL_Log("Invalid speed_curve value: %s", value);
+                    *out_invalid = true;
+                    return false;
+                }
+                parsed_config.speed_curve = parsed;
+            } else if (SDL_strcasecmp(key, "speed_step") == 0) {
+                size_t parsed = 0;
+                if (config_parse_size(value, &parsed) == false) {
+                    SDL_Log("Invalid speed_step value: %s", value);
+                    *out_invalid = true;
+                    return false;
+                }
+                parsed_config.speed_step = parsed > SNAKE_SPEED_STEP_MAX ? SNAKE_SPEED_STEP_MAX + 1 : (int)parsed;
             }
         }
 
@@ -234,8 +372,14 @@ bool config_serialize(const game_config_t* config, char* out_buffer, size_t buff
     config_normalize(&normalized);
 
     const int written =
-        snprintf(out_buffer, buffer_size, "high_score=%zu\nmute=%d\nvolume=%.3f\nresume_delay=%d\n",
-                 normalized.high_score, normalized.mute ? 1 : 0, normalized.volume, normalized.resume_delay_seconds);
+        snprintf(out_buffer, buffer_size,
+                 "high_score=%zu\nmute=%d\nvolume=%.3f\nresume_delay=%d\ngrid_width=%d\ngrid_height=%d\nfullscreen=%d\n"
+                 "vsync=%d\nfps_cap=%d\ntick_rate=%d\ntick_rate_max=%d\nspeed_curve=%s\nspeed_step=%d\n",
+                 normalized.high_score, normalized.mute ? 1 : 0, normalized.volume, normalized.resume_delay_seconds,
+                 normalized.grid_width, normalized.grid_height, normalized.fullscreen ? 1 : 0,
+                 normalized.vsync ? 1 : 0, normalized.fps_cap,
+                 normalized.tick_rate, normalized.tick_rate_max, k_speed_curve_names[normalized.speed_curve],
+                 normalized.speed_step);
     if (written < 0 || (size_t)written >= buffer_size) {
         SDL_Log("Config buffer is too small for serialization");
         return false;
@@ -261,7 +405,7 @@ static bool config_write_file(const char* path, const game_config_t* config) {
         return false;
     }
 
-    char serialized[128];
+    char serialized[512];
     if (config_serialize(config, serialized, sizeof(serialized)) == false) {
         fclose(file);
         return false;
@@ -4,15 +4,37 @@
 #include <stdbool.h>
 #include <stddef.h>
 
+#include "../core/snake_speed.h"
+
 #define CONFIG_RESUME_DELAY_MIN 0
 #define CONFIG_RESUME_DELAY_MAX 3
 #define CONFIG_RESUME_DELAY_DEFAULT 2
 
+#define CONFIG_GRID_SIZE_MIN 16
+#define CONFIG_GRID_SIZE_MAX 4096
+#define CONFIG_GRID_SIZE_DEFAULT 50
+
+/* 0 leaves the frame rate to vsync; any other value is clamped to [MIN, MAX]. */
+#define CONFIG_FPS_CAP_MIN 15
+#define CONFIG_FPS_CAP_MAX 1000
+#define CONFIG_FPS_CAP_DEFAULT 0
+
 typedef struct {
     size_t high_score;
     bool mute;
     float volume;
     int resume_delay_seconds;
+    int grid_width;
+    int grid_height;
+    bool fullscreen;
+    bool vsync;
+    int fps_cap;
+    /* Ticks per second in [SNAKE_SPEED_RATE_MIN, SNAKE_SPEED_RATE_MAX]; tick_rate_max is kept >= tick_rate. */
+    int tick_rate;
+    int tick_rate_max;
+    /* Stored as "constant", "linear" or "stepped". */
+    snake_speed_curve_t speed_curve;
+    int speed_step;
 } game_config_t;
 
 void config_set_defaults(game_config_t* config);
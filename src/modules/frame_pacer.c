@@ -0,0 +1,60 @@
+#include "frame_pacer.h"
+
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_events.h>
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_timer.h>
+
+void frame_pacer_init(frame_pacer_t* pacer, int fps_cap) {
+    SDL_assert(pacer != NULL);
+
+    pacer->next_frame = 0;
+    frame_pacer_set_fps_cap(pacer, fps_cap);
+}
+
+void frame_pacer_set_fps_cap(frame_pacer_t* pacer, int fps_cap) {
+    SDL_assert(pacer != NULL);
+    SDL_assert(fps_cap >= 0);
+
+    pacer->frame_interval = fps_cap > 0 ? SDL_NS_PER_SECOND / (Uint64)fps_cap : 0;
+    pacer->next_frame = 0;
+}
+
+Uint64 frame_pacer_schedule(frame_pacer_t* pacer, Uint64 time_now) {
+    SDL_assert(pacer != NULL);
+
+    if (pacer->frame_interval == 0) {
+        return 0;
+    }
+
+    // First frame, or more than a whole frame behind: start a new cadence from now rather than rushing to catch up.
+    if (pacer->next_frame == 0 || time_now >= pacer->next_frame + pacer->frame_interval) {
+        pacer->next_frame = time_now + pacer->frame_interval;
+        return 0;
+    }
+
+    const Uint64 frame_start = pacer->next_frame;
+    pacer->next_frame += pacer->frame_interval;
+    return time_now < frame_start ? frame_start - time_now : 0;
+}
+
+void frame_pacer_end_frame(frame_pacer_t* pacer) {
+    SDL_assert(pacer != NULL);
+
+    const Uint64 sleep_time = frame_pacer_schedule(pacer, SDL_GetTicksNS());
+    if (sleep_time > 0) {
+        // Sleeps coarsely, then spins out the last stretch, so frames are not late by a scheduler quantum.
+        SDL_DelayPrecise(sleep_time);
+    }
+}
+
+bool frame_pacer_wait_for_event(frame_pacer_t* pacer) {
+    SDL_assert(pacer != NULL);
+
+    pacer->next_frame = 0;
+    if (SDL_WaitEvent(NULL) == false) {
+        SDL_Log("Failed to wait for events: %s", SDL_GetError());
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,51 @@
+#ifndef FRAME_PACER_H
+#define FRAME_PACER_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Keeps frames from starting more often than a configured rate.
+ *
+ * Frames are scheduled on a fixed cadence rather than "interval after the last one finished", so time spent rendering
+ * counts towards the interval and the rate does not drift. A frame that runs more than a whole interval late restarts
+ * the cadence instead of being followed by a burst of unthrottled catch-up frames.
+ *
+ * @note All time values are in nanoseconds.
+ */
+typedef struct {
+    /* 0 when uncapped. */
+    Uint64 frame_interval;
+    /* When the next frame may start; 0 until the first frame has ended. */
+    Uint64 next_frame;
+} frame_pacer_t;
+
+/**
+ * @param fps_cap Frames per second to stay under, or 0 for no limit (e.g. when vsync already paces presentation).
+ */
+void frame_pacer_init(frame_pacer_t* pacer, int fps_cap);
+void frame_pacer_set_fps_cap(frame_pacer_t* pacer, int fps_cap);
+
+/**
+ * @brief Advance the schedule to the frame that ended at time_now.
+ *
+ * @return How long to sleep before starting the next frame, 0 if it may start straight away.
+ */
+Uint64 frame_pacer_schedule(frame_pacer_t* pacer, Uint64 time_now);
+
+/**
+ * @brief Call once per frame after presenting: sleeps precisely until the next frame is due.
+ */
+void frame_pacer_end_frame(frame_pacer_t* pacer);
+
+/**
+ * @brief Block until an input or window event is queued, leaving it in the queue.
+ *
+ * Used while nothing on screen animates, so an idle menu costs no CPU. The cadence restarts afterwards, so the first
+ * frame after waking is not throttled.
+ *
+ * @return false if waiting failed; the caller should fall back to polling.
+ */
+bool frame_pacer_wait_for_event(frame_pacer_t* pacer);
+
+#endif  // FRAME_PACER_H
@@ -0,0 +1,223 @@
+#include "glyph_atlas.h"
+
+#include <string.h>
+#include <SDL3/SDL_log.h>
+
+/* Glyphs are packed in rows this wide; ASCII at menu sizes fits in a handful of rows. */
+static const int k_atlas_width = 512;
+
+/* Empty pixels kept between glyphs so filtering never bleeds a neighbour in. */
+static const int k_glyph_padding = 1;
+
+enum { k_vertices_per_quad = 4, k_indices_per_quad = 6 };
+
+static const glyph_atlas_glyph_t* get_glyph(const glyph_atlas_t* atlas, char c) {
+    const unsigned char code = (unsigned char)c;
+    if (code < GLYPH_ATLAS_FIRST_CHAR || code > GLYPH_ATLAS_LAST_CHAR) {
+        return &atlas->glyphs[GLYPH_ATLAS_FALLBACK_CHAR - GLYPH_ATLAS_FIRST_CHAR];
+    }
+    return &atlas->glyphs[code - GLYPH_ATLAS_FIRST_CHAR];
+}
+
+/**
+ * @brief Render every glyph, pack them into rows and upload the result as the atlas texture.
+ *
+ * Glyphs the font cannot render (and the space, which has no pixels) keep an empty source rectangle and only advance
+ * the pen.
+ */
+static bool build_texture(glyph_atlas_t* atlas, SDL_Renderer* renderer) {
+    SDL_Surface* glyph_surfaces[GLYPH_ATLAS_GLYPH_COUNT];
+    const SDL_Color white = {255, 255, 255, 255};
+    atlas->line_height = TTF_GetFontHeight(atlas->font);
+
+    int pen_x = 0;
+    int pen_y = 0;
+    int row_height = 0;
+    for (int i = 0; i < GLYPH_ATLAS_GLYPH_COUNT; ++i) {
+        const Uint32 code = (Uint32)(GLYPH_ATLAS_FIRST_CHAR + i);
+        glyph_atlas_glyph_t* const glyph = &atlas->glyphs[i];
+        glyph->source = (SDL_FRect){0.0f, 0.0f, 0.0f, 0.0f};
+
+        SDL_Surface* const surface = TTF_RenderGlyph_Blended(atlas->font, code, white);
+        glyph_surfaces[i] = surface;
+
+        int advance = 0;
+        if (TTF_GetGlyphMetrics(atlas->font, code, NULL, NULL, NULL, NULL, &advance) == false) {
+            advance = surface != NULL ? surface->w : 0;
+        }
+        glyph->advance = (float)advance;
+
+        if (surface == NULL || surface->w <= 0 || surface->h <= 0) {
+            continue;
+        }
+
+        if (pen_x + surface->w > k_atlas_width) {
+            pen_x = 0;
+            pen_y += row_height + k_glyph_padding;
+            row_height = 0;
+        }
+        glyph->source = (SDL_FRect){(float)pen_x, (float)pen_y, (float)surface->w, (float)surface->h};
+        pen_x += surface->w + k_glyph_padding;
+        row_height = SDL_max(row_height, surface->h);
+    }
+
+    const int atlas_height = SDL_max(pen_y + row_height, 1);
+    SDL_Surface* const atlas_surface = SDL_CreateSurface(k_atlas_width, atlas_height, SDL_PIXELFORMAT_RGBA32);
+    bool success = atlas_surface != NULL;
+    if (success == false) {
+        SDL_Log("Failed to create %dx%d glyph atlas surface: %s", k_atlas_width, atlas_height, SDL_GetError());
+    }
+
+    for (int i = 0; i < GLYPH_ATLAS_GLYPH_COUNT; ++i) {
+        SDL_Surface* const surface = glyph_surfaces[i];
+        if (surface == NULL) {
+            continue;
+        }
+
+        const SDL_FRect* const source = &atlas->glyphs[i].source;
+        if (success == true && source->w > 0.0f) {
+            // Copy the coverage as is instead of blending it onto the transparent atlas.
+            const SDL_Rect dest = {(int)source->x, (int)source->y, (int)source->w, (int)source->h};
+            if (SDL_SetSurfaceBlendMode(surface, SDL_BLENDMODE_NONE) == false ||
+                SDL_BlitSurface(surface, NULL, atlas_surface, &dest) == false) {
+                SDL_Log("Failed to copy glyph %d into the atlas: %s", GLYPH_ATLAS_FIRST_CHAR + i, SDL_GetError());
+                success = false;
+            }
+        }
+        SDL_DestroySurface(surface);
+    }
+
+    if (success == true) {
+        atlas->texture = SDL_CreateTextureFromSurface(renderer, atlas_surface);
+        if (atlas->texture == NULL) {
+            SDL_Log("Failed to create glyph atlas texture: %s", SDL_GetError());
+            success = false;
+        } else if (SDL_SetTextureBlendMode(atlas->texture, SDL_BLENDMODE_BLEND) == false) {
+            SDL_Log("Failed to set glyph atlas blend mode: %s", SDL_GetError());
+            SDL_DestroyTexture(atlas->texture);
+            atlas->texture = NULL;
+            success = false;
+        }
+    }
+
+    if (atlas_surface != NULL) {
+        SDL_DestroySurface(atlas_surface);
+    }
+
+    atlas->texture_width = k_atlas_width;
+    atlas->texture_height = atlas_height;
+    return success;
+}
+
+bool glyph_atlas_create(glyph_atlas_t* atlas, SDL_Renderer* renderer, TTF_Font* font) {
+    SDL_assert(atlas != NULL);
+    SDL_assert(renderer != NULL);
+    SDL_assert(font != NULL);
+
+    memset(atlas, 0, sizeof(*atlas));
+    atlas->font = font;
+
+    // Two triangles per quad, corners ordered top-left, top-right, bottom-right, bottom-left.
+    for (int quad = 0; quad < GLYPH_ATLAS_MAX_TEXT; ++quad) {
+        int* const index = &atlas->indices[quad * k_indices_per_quad];
+        const int first = quad * k_vertices_per_quad;
+        index[0] = first;
+        index[1] = first + 1;
+        index[2] = first + 2;
+        index[3] = first + 2;
+        index[4] = first + 3;
+        index[5] = first;
+    }
+
+    return build_texture(atlas, renderer);
+}
+
+void glyph_atlas_destroy(glyph_atlas_t* atlas) {
+    SDL_assert(atlas != NULL);
+
+    glyph_atlas_release_texture(atlas);
+    atlas->font = NULL;
+}
+
+void glyph_atlas_release_texture(glyph_atlas_t* atlas) {
+    SDL_assert(atlas != NULL);
+
+    if (atlas->texture != NULL) {
+        SDL_DestroyTexture(atlas->texture);
+        atlas->texture = NULL;
+    }
+}
+
+bool glyph_atlas_rebuild(glyph_atlas_t* atlas, SDL_Renderer* renderer) {
+    SDL_assert(atlas != NULL);
+    SDL_assert(atlas->font != NULL);
+    SDL_assert(renderer != NULL);
+
+    glyph_atlas_release_texture(atlas);
+    return build_texture(atlas, renderer);
+}
+
+void glyph_atlas_measure(const glyph_atlas_t* atlas, const char* text, vector2i_t* out_size) {
+    SDL_assert(atlas != NULL);
+    SDL_assert(text != NULL);
+    SDL_assert(out_size != NULL);
+
+    float width = 0.0f;
+    for (const char* c = text; *c != '\0'; ++c) {
+        width += get_glyph(atlas, *c)->advance;
+    }
+
+    out_size->x = (int)width;
+    out_size->y = atlas->line_height;
+}
+
+bool glyph_atlas_draw(glyph_atlas_t* atlas, SDL_Renderer* renderer, const char* text, float x, float y,
+                      SDL_FColor color) {
+    SDL_assert(atlas != NULL);
+    SDL_assert(atlas->font != NULL);
+    SDL_assert(renderer != NULL);
+    SDL_assert(text != NULL);
+
+    if (atlas->texture == NULL && build_texture(atlas, renderer) == false) {
+        return false;
+    }
+
+    const float texel_u = 1.0f / (float)atlas->texture_width;
+    const float texel_v = 1.0f / (float)atlas->texture_height;
+
+    // Glyphs are sampled 1:1, so keep them on whole pixels to stay sharp.
+    float pen_x = SDL_roundf(x);
+    const float top = SDL_roundf(y);
+
+    int quad_count = 0;
+    for (const char* c = text; *c != '\0' && quad_count < GLYPH_ATLAS_MAX_TEXT; ++c) {
+        const glyph_atlas_glyph_t* const glyph = get_glyph(atlas, *c);
+        const SDL_FRect* const source = &glyph->source;
+        if (source->w > 0.0f) {
+            const float u0 = source->x * texel_u;
+            const float v0 = source->y * texel_v;
+            const float u1 = (source->x + source->w) * texel_u;
+            const float v1 = (source->y + source->h) * texel_v;
+
+            SDL_Vertex* const vertex = &atlas->vertices[quad_count * k_vertices_per_quad];
+            vertex[0] = (SDL_Vertex){{pen_x, top}, color, {u0, v0}};
+            vertex[1] = (SDL_Vertex){{pen_x + source->w, top}, color, {u1, v0}};
+            vertex[2] = (SDL_Vertex){{pen_x + source->w, top + source->h}, color, {u1, v1}};
+            vertex[3] = (SDL_Vertex){{pen_x, top + source->h}, color, {u0, v1}};
+            quad_count++;
+        }
+        pen_x += glyph->advance;
+    }
+
+    if (quad_count == 0) {
+        return true;
+    }
+
+    if (SDL_RenderGeometry(renderer, atlas->texture, atlas->vertices, quad_count * k_vertices_per_quad,
+                           atlas->indices, quad_count * k_indices_per_quad) == false) {
+        SDL_Log("Failed to draw atlas text: %s", SDL_GetError());
+        return false;
+    }
+
+    return true;
+}
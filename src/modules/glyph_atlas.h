@@ -0,0 +1,94 @@
+#ifndef GLYPH_ATLAS_H
+#define GLYPH_ATLAS_H
+
+#include <SDL3/SDL_render.h>
+#include <SDL3_ttf/SDL_ttf.h>
+
+#include "../utils/vector.h"
+
+/* Printable ASCII; anything else is drawn as GLYPH_ATLAS_FALLBACK_CHAR. */
+#define GLYPH_ATLAS_FIRST_CHAR 32
+#define GLYPH_ATLAS_LAST_CHAR 126
+#define GLYPH_ATLAS_GLYPH_COUNT (GLYPH_ATLAS_LAST_CHAR - GLYPH_ATLAS_FIRST_CHAR + 1)
+#define GLYPH_ATLAS_FALLBACK_CHAR '?'
+
+/* Longest string one glyph_atlas_draw() call takes; the rest is cut off. */
+#define GLYPH_ATLAS_MAX_TEXT 64
+
+typedef struct {
+    /* Where the glyph sits in the atlas texture, in pixels. */
+    SDL_FRect source;
+    /* How far the pen moves after drawing it. */
+    float advance;
+} glyph_atlas_glyph_t;
+
+/**
+ * @brief Every printable ASCII glyph of one font, rasterized once into a single texture.
+ *
+ * Strings drawn from it are plain textured quads, one per character, submitted with a single SDL_RenderGeometry()
+ * call. Nothing is shaped and no texture is created per string, so text that changes every frame or every tick
+ * (scores, countdowns, slider values) costs no more than text that never changes. The price is that there is no
+ * kerning and no text beyond ASCII, which is fine for numbers and short labels; everything else should stay a
+ * TTF_Text.
+ *
+ * Glyphs are rendered white, so the vertex color passed to glyph_atlas_draw() is the text color.
+ */
+typedef struct {
+    TTF_Font* font;
+    SDL_Texture* texture;
+    glyph_atlas_glyph_t glyphs[GLYPH_ATLAS_GLYPH_COUNT];
+    int texture_width;
+    int texture_height;
+    int line_height;
+
+    SDL_Vertex vertices[GLYPH_ATLAS_MAX_TEXT * 4];
+    int indices[GLYPH_ATLAS_MAX_TEXT * 6];
+} glyph_atlas_t;
+
+/**
+ * @brief Rasterize the glyphs of a font and upload them as one texture.
+ *
+ * @param atlas Atlas to fill.
+ * @param renderer Renderer the texture is created for.
+ * @param font Font to rasterize. It must outlive the atlas, which rebuilds its texture from it after a device reset.
+ * @return false if a glyph could not be rendered or the texture could not be created.
+ */
+bool glyph_atlas_create(glyph_atlas_t* atlas, SDL_Renderer* renderer, TTF_Font* font);
+void glyph_atlas_destroy(glyph_atlas_t* atlas);
+
+/**
+ * @brief Drop the atlas texture so the next glyph_atlas_draw() rasterizes and uploads it again.
+ */
+void glyph_atlas_release_texture(glyph_atlas_t* atlas);
+
+/**
+ * @brief Rasterize the font again right away, picking up a new font size for both drawing and measuring.
+ *
+ * @return false if a glyph could not be rendered or the texture could not be created.
+ */
+bool glyph_atlas_rebuild(glyph_atlas_t* atlas, SDL_Renderer* renderer);
+
+/**
+ * @brief Size of a string as glyph_atlas_draw() would draw it.
+ *
+ * @param atlas Atlas to measure with.
+ * @param text NUL-terminated string.
+ * @param out_size Output width and height in pixels.
+ */
+void glyph_atlas_measure(const glyph_atlas_t* atlas, const char* text, vector2i_t* out_size);
+
+/**
+ * @brief Draw a string with its top-left corner at (x, y).
+ *
+ * @param atlas Atlas to draw from.
+ * @param renderer Renderer to draw with; must be the one the atlas was created for.
+ * @param text NUL-terminated string, at most GLYPH_ATLAS_MAX_TEXT characters.
+ * @param x Left edge in pixels.
+ * @param y Top edge in pixels.
+ * @param color Text color.
+ * @return false if the texture had to be rebuilt and could not be, or the renderer rejected the draw.
+ */
+bool glyph_atlas_draw(glyph_atlas_t* atlas, SDL_Renderer* renderer, const char* text, float x, float y,
+                      SDL_FColor color);
+
+#endif  // GLYPH_ATLAS_H
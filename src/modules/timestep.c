@@ -0,0 +1,68 @@
+#include "timestep.h"
+
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_timer.h>
+
+void timestep_init(timestep_t* step, Uint32 rate_numerator, Uint32 rate_denominator, int max_ticks_per_frame,
+                   Uint64 time_now) {
+    SDL_assert(step != NULL);
+    SDL_assert(max_ticks_per_frame > 0);
+
+    step->accumulator = 0;
+    step->max_ticks_per_frame = max_ticks_per_frame;
+    timestep_set_rate(step, rate_numerator, rate_denominator);
+    timestep_reset(step, time_now);
+}
+
+void timestep_set_rate(timestep_t* step, Uint32 rate_numerator, Uint32 rate_denominator) {
+    SDL_assert(step != NULL);
+    SDL_assert(rate_numerator > 0);
+    SDL_assert(rate_denominator > 0);
+
+    const Uint64 tick_units = SDL_NS_PER_SECOND * (Uint64)rate_denominator;
+    if (step->accumulator > 0) {
+        // The units change with the rate, so carry the fraction of a tick over instead of the raw count.
+        const double alpha = (double)step->accumulator / (double)step->tick_units;
+        step->accumulator = (Uint64)(alpha * (double)tick_units);
+        if (step->accumulator >= tick_units) {
+            step->accumulator = tick_units - 1;
+        }
+    }
+
+    step->rate_numerator = rate_numerator;
+    step->rate_denominator = rate_denominator;
+    step->tick_units = tick_units;
+}
+
+void timestep_reset(timestep_t* step, Uint64 time_now) {
+    SDL_assert(step != NULL);
+
+    step->accumulator = 0;
+    step->time_last = time_now;
+}
+
+int timestep_advance(timestep_t* step, Uint64 time_now) {
+    SDL_assert(step != NULL);
+
+    const Uint64 elapsed = time_now > step->time_last ? time_now - step->time_last : 0;
+    step->time_last = time_now;
+
+    // Anything past max_ticks_per_frame + 1 ticks is dropped anyway; capping first keeps the product from overflowing.
+    const Uint64 cap_units = (Uint64)(step->max_ticks_per_frame + 1) * step->tick_units;
+    const Uint64 units = elapsed > cap_units / step->rate_numerator ? cap_units : elapsed * step->rate_numerator;
+
+    step->accumulator += units;
+    Uint64 ticks = step->accumulator / step->tick_units;
+    step->accumulator %= step->tick_units;
+
+    if (ticks > (Uint64)step->max_ticks_per_frame) {
+        ticks = (Uint64)step->max_ticks_per_frame;
+    }
+    return (int)ticks;
+}
+
+float timestep_get_alpha(const timestep_t* step) {
+    SDL_assert(step != NULL);
+
+    return (float)((double)step->accumulator / (double)step->tick_units);
+}
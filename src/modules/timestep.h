@@ -0,0 +1,65 @@
+#ifndef TIMESTEP_H
+#define TIMESTEP_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Decides how many fixed-length simulation ticks each rendered frame should run.
+ *
+ * The tick rate is a fraction of ticks per second, and time is accumulated in nanoseconds scaled by its numerator,
+ * so one tick is exactly SDL_NS_PER_SECOND * rate_denominator units. Nothing is rounded per tick, so rates that do
+ * not divide a second evenly (7 per second, 17 per 2 seconds) keep their long-run schedule exactly.
+ *
+ * After a stall (a dragged window, a breakpoint, a slow frame) the simulation would have to run many ticks at once to
+ * catch up, and if those ticks take longer than the time they cover it falls further behind each frame. At most
+ * max_ticks_per_frame ticks are handed out per frame; the rest of the backlog is dropped and the game runs slower
+ * than real time for that moment instead.
+ *
+ * @note All time values are in nanoseconds.
+ */
+typedef struct {
+    Uint64 rate_numerator;
+    Uint64 rate_denominator;
+    /* Accumulator units per tick: SDL_NS_PER_SECOND * rate_denominator. */
+    Uint64 tick_units;
+    /* Elapsed time times rate_numerator; less than tick_units between frames. */
+    Uint64 accumulator;
+    Uint64 time_last;
+    int max_ticks_per_frame;
+} timestep_t;
+
+/**
+ * @brief Start a schedule of rate_numerator / rate_denominator ticks per second, counting from time_now.
+ *
+ * @param max_ticks_per_frame Upper bound on what timestep_advance() returns, at least 1.
+ */
+void timestep_init(timestep_t* step, Uint32 rate_numerator, Uint32 rate_denominator, int max_ticks_per_frame,
+                   Uint64 time_now);
+
+/**
+ * @brief Change the tick rate, keeping how far the current tick has progressed.
+ */
+void timestep_set_rate(timestep_t* step, Uint32 rate_numerator, Uint32 rate_denominator);
+
+/**
+ * @brief Forget any accumulated time and count from time_now, e.g. after the loop slept waiting for input.
+ */
+void timestep_reset(timestep_t* step, Uint64 time_now);
+
+/**
+ * @brief Account for the time since the last call.
+ *
+ * @return How many ticks to run this frame, between 0 and max_ticks_per_frame.
+ */
+int timestep_advance(timestep_t* step, Uint64 time_now);
+
+/**
+ * @brief Get how far time has moved past the last tick, as a fraction of a tick in [0, 1).
+ *
+ * Renderers blend between the previous and the current tick's state with it, so motion looks smooth at frame rates
+ * above the tick rate.
+ */
+float timestep_get_alpha(const timestep_t* step);
+
+#endif  // TIMESTEP_H
@@ -206,12 +206,21 @@ void ui_slider_layout(ui_slider_t* slider, float center_x, float center_y, float
 bool ui_slider_contains(const ui_slider_t* slider, float x, float y) {
     SDL_assert(slider != NULL);
 
+    SDL_FRect bounds;
+    ui_slider_get_bounds(slider, &bounds);
+    return x >= bounds.x && x <= bounds.x + bounds.w && y >= bounds.y && y <= bounds.y + bounds.h;
+}
+
+void ui_slider_get_bounds(const ui_slider_t* slider, SDL_FRect* out_rect) {
+    SDL_assert(slider != NULL);
+    SDL_assert(out_rect != NULL);
+
     const float min_x = slider->track_rect.x - slider->knob_rect.w * 0.5f;
     const float max_x = slider->track_rect.x + slider->track_rect.w + slider->knob_rect.w * 0.5f;
     const float min_y = SDL_min(slider->track_rect.y, slider->knob_rect.y);
     const float max_y = SDL_max(slider->track_rect.y + slider->track_rect.h,
                                 slider->knob_rect.y + slider->knob_rect.h);
-    return x >= min_x && x <= max_x && y >= min_y && y <= max_y;
+    *out_rect = (SDL_FRect){min_x, min_y, max_x - min_x, max_y - min_y};
 }
 
 float ui_slider_get_value(const ui_slider_t* slider, float x) {
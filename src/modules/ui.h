@@ -164,6 +164,11 @@ void ui_slider_init(ui_slider_t* slider, SDL_Color track_color, SDL_Color fill_c
                     SDL_Color border_color);
 void ui_slider_layout(ui_slider_t* slider, float center_x, float center_y, float width, float height, float knob_width);
 bool ui_slider_contains(const ui_slider_t* slider, float x, float y);
+/**
+ * @brief Area ui_slider_contains() accepts: the track, widened by half the knob on each side so the ends can be
+ *        grabbed, and tall enough for the knob.
+ */
+void ui_slider_get_bounds(const ui_slider_t* slider, SDL_FRect* out_rect);
 float ui_slider_get_value(const ui_slider_t* slider, float x);
 bool ui_slider_render(SDL_Renderer* renderer, const ui_slider_t* slider, float value);
 
@@ -0,0 +1,144 @@
+#include "ui_tree.h"
+
+#include <string.h>
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_bits.h>
+
+SDL_COMPILE_TIME_ASSERT(ui_tree_cell_fits_widgets, UI_TREE_MAX_WIDGETS <= 32);
+
+static bool rect_contains(const SDL_FRect* rect, float x, float y) {
+    return x >= rect->x && x <= rect->x + rect->w && y >= rect->y && y <= rect->y + rect->h;
+}
+
+/**
+ * @brief Grid column or row a coordinate falls in, clamped to the grid.
+ */
+static int get_cell(float position, float origin, float extent) {
+    if (extent <= 0.f) {
+        return 0;
+    }
+    const int cell = (int)SDL_floorf((position - origin) * (float)UI_TREE_GRID_SIZE / extent);
+    return SDL_clamp(cell, 0, UI_TREE_GRID_SIZE - 1);
+}
+
+void ui_tree_init(ui_tree_t* tree) {
+    SDL_assert(tree != NULL);
+
+    const SDL_FRect empty = {0.f, 0.f, 0.f, 0.f};
+    ui_tree_begin(tree, &empty);
+    ui_tree_reset_pointer(tree);
+}
+
+void ui_tree_begin(ui_tree_t* tree, const SDL_FRect* bounds) {
+    SDL_assert(tree != NULL);
+    SDL_assert(bounds != NULL);
+
+    tree->widget_count = 0;
+    memset(tree->index_by_id, UI_WIDGET_NONE, sizeof(tree->index_by_id));
+    memset(tree->cells, 0, sizeof(tree->cells));
+    tree->bounds = *bounds;
+}
+
+void ui_tree_add(ui_tree_t* tree, int id, int parent_id, const SDL_FRect* rect) {
+    SDL_assert(tree != NULL);
+    SDL_assert(id >= 0 && id < UI_TREE_MAX_WIDGETS);
+    SDL_assert(tree->index_by_id[id] == UI_WIDGET_NONE);
+    SDL_assert(parent_id == UI_WIDGET_NONE || (parent_id >= 0 && parent_id < UI_TREE_MAX_WIDGETS));
+    SDL_assert(rect != NULL);
+    SDL_assert(tree->widget_count < UI_TREE_MAX_WIDGETS);
+
+    const int index = tree->widget_count;
+    ui_widget_t* const widget = &tree->widgets[index];
+    widget->id = id;
+    widget->parent = parent_id == UI_WIDGET_NONE ? UI_WIDGET_NONE : tree->index_by_id[parent_id];
+    widget->rect = *rect;
+    tree->index_by_id[id] = (Sint8)index;
+    tree->widget_count++;
+
+    const SDL_FRect* const bounds = &tree->bounds;
+    const int first_column = get_cell(rect->x, bounds->x, bounds->w);
+    const int last_column = get_cell(rect->x + rect->w, bounds->x, bounds->w);
+    const int first_row = get_cell(rect->y, bounds->y, bounds->h);
+    const int last_row = get_cell(rect->y + rect->h, bounds->y, bounds->h);
+    for (int row = first_row; row <= last_row; ++row) {
+        for (int column = first_column; column <= last_column; ++column) {
+            tree->cells[row * UI_TREE_GRID_SIZE + column] |= 1u << index;
+        }
+    }
+}
+
+void ui_tree_reset_pointer(ui_tree_t* tree) {
+    SDL_assert(tree != NULL);
+
+    tree->hovered_id = UI_WIDGET_NONE;
+    tree->pressed_id = UI_WIDGET_NONE;
+}
+
+bool ui_tree_get_rect(const ui_tree_t* tree, int id, SDL_FRect* out_rect) {
+    SDL_assert(tree != NULL);
+    SDL_assert(out_rect != NULL);
+
+    if (id < 0 || id >= UI_TREE_MAX_WIDGETS || tree->index_by_id[id] == UI_WIDGET_NONE) {
+        return false;
+    }
+
+    *out_rect = tree->widgets[tree->index_by_id[id]].rect;
+    return true;
+}
+
+int ui_tree_hit_test(const ui_tree_t* tree, float x, float y) {
+    SDL_assert(tree != NULL);
+
+    if (rect_contains(&tree->bounds, x, y) == false) {
+        return UI_WIDGET_NONE;
+    }
+
+    const int column = get_cell(x, tree->bounds.x, tree->bounds.w);
+    const int row = get_cell(y, tree->bounds.y, tree->bounds.h);
+    Uint32 candidates = tree->cells[row * UI_TREE_GRID_SIZE + column];
+
+    // Topmost first: the highest set bit is the widget added last.
+    while (candidates != 0) {
+        const int index = SDL_MostSignificantBitIndex32(candidates);
+        candidates &= ~(1u << index);
+
+        bool is_hit = true;
+        for (int i = index; i != UI_WIDGET_NONE && is_hit == true; i = tree->widgets[i].parent) {
+            is_hit = rect_contains(&tree->widgets[i].rect, x, y);
+        }
+        if (is_hit == true) {
+            return tree->widgets[index].id;
+        }
+    }
+
+    return UI_WIDGET_NONE;
+}
+
+bool ui_tree_pointer_move(ui_tree_t* tree, float x, float y) {
+    SDL_assert(tree != NULL);
+
+    const int hovered_id = ui_tree_hit_test(tree, x, y);
+    if (hovered_id == tree->hovered_id) {
+        return false;
+    }
+
+    tree->hovered_id = hovered_id;
+    return true;
+}
+
+int ui_tree_pointer_down(ui_tree_t* tree, float x, float y) {
+    SDL_assert(tree != NULL);
+
+    tree->hovered_id = ui_tree_hit_test(tree, x, y);
+    tree->pressed_id = tree->hovered_id;
+    return tree->pressed_id;
+}
+
+int ui_tree_pointer_up(ui_tree_t* tree, float x, float y) {
+    SDL_assert(tree != NULL);
+
+    const int pressed_id = tree->pressed_id;
+    tree->pressed_id = UI_WIDGET_NONE;
+    tree->hovered_id = ui_tree_hit_test(tree, x, y);
+    return pressed_id != UI_WIDGET_NONE && pressed_id == tree->hovered_id ? pressed_id : UI_WIDGET_NONE;
+}
@@ -0,0 +1,111 @@
+#ifndef UI_TREE_H
+#define UI_TREE_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_rect.h>
+#include <SDL3/SDL_stdinc.h>
+
+/* Widgets one tree holds; ids run from 0 to UI_TREE_MAX_WIDGETS - 1. */
+#define UI_TREE_MAX_WIDGETS 32
+
+/* The tree's bounds are split into this many cells on each axis for hit testing. */
+#define UI_TREE_GRID_SIZE 8
+
+/* Returned by lookups that found no widget, and the parent of top-level widgets. */
+#define UI_WIDGET_NONE (-1)
+
+typedef struct {
+    int id;
+    /* Index of the parent in ui_tree_t::widgets, or UI_WIDGET_NONE. */
+    int parent;
+    /* Where the widget is, in the same pixels pointer positions come in. */
+    SDL_FRect rect;
+} ui_widget_t;
+
+/**
+ * @brief Retained widget rectangles with hover and press state, for answering "what is under the pointer" without
+ *        recomputing a layout.
+ *
+ * Widgets are added after the layout that places them is computed, and stay until the next ui_tree_begin(), so input
+ * handling reads the same rectangles rendering was given. Later widgets sit on top of earlier ones, and a widget only
+ * takes the pointer where its parent does too, so children are added after the panel that holds them.
+ *
+ * Each grid cell keeps a bit per widget overlapping it, so a hit test only looks at the few widgets in the pointer's
+ * cell, whatever the size of the tree. Fixed size and allocation-free.
+ *
+ * Hover and press state are kept by id, so they carry over when the same widgets are laid out again (e.g. while a
+ * slider is dragged and its value label changes width).
+ */
+typedef struct {
+    ui_widget_t widgets[UI_TREE_MAX_WIDGETS];
+    int widget_count;
+    Sint8 index_by_id[UI_TREE_MAX_WIDGETS];
+
+    SDL_FRect bounds;
+    Uint32 cells[UI_TREE_GRID_SIZE * UI_TREE_GRID_SIZE];
+
+    int hovered_id;
+    int pressed_id;
+} ui_tree_t;
+
+/**
+ * @brief Start with an empty tree and no hover or press.
+ */
+void ui_tree_init(ui_tree_t* tree);
+
+/**
+ * @brief Remove every widget to lay them out again, keeping hover and press state.
+ *
+ * @param bounds Area the widgets are in, usually the whole output. Widgets reaching outside it can only be hit inside.
+ */
+void ui_tree_begin(ui_tree_t* tree, const SDL_FRect* bounds);
+
+/**
+ * @brief Add a widget on top of those already added.
+ *
+ * Ids are unique and below UI_TREE_MAX_WIDGETS, so the tree cannot run out of room.
+ *
+ * @param id Caller-chosen id in [0, UI_TREE_MAX_WIDGETS), not yet added since ui_tree_begin().
+ * @param parent_id Id of an already added widget this one sits in, or UI_WIDGET_NONE.
+ */
+void ui_tree_add(ui_tree_t* tree, int id, int parent_id, const SDL_FRect* rect);
+
+/**
+ * @brief Forget hover and press, e.g. when switching to another screen.
+ */
+void ui_tree_reset_pointer(ui_tree_t* tree);
+
+/**
+ * @brief Get the rectangle a widget was added with.
+ *
+ * @return false if no widget has that id.
+ */
+bool ui_tree_get_rect(const ui_tree_t* tree, int id, SDL_FRect* out_rect);
+
+/**
+ * @brief Id of the topmost widget at (x, y), or UI_WIDGET_NONE.
+ */
+int ui_tree_hit_test(const ui_tree_t* tree, float x, float y);
+
+/**
+ * @brief Update the hovered widget for a pointer at (x, y).
+ *
+ * @return true if the hovered widget changed.
+ */
+bool ui_tree_pointer_move(ui_tree_t* tree, float x, float y);
+
+/**
+ * @brief Press the widget at (x, y), which stays pressed until ui_tree_pointer_up() wherever the pointer moves.
+ *
+ * @return Id of the pressed widget, or UI_WIDGET_NONE.
+ */
+int ui_tree_pointer_down(ui_tree_t* tree, float x, float y);
+
+/**
+ * @brief Release the pressed widget.
+ *
+ * @return Id of the widget if the pointer was released over the one it pressed, otherwise UI_WIDGET_NONE.
+ */
+int ui_tree_pointer_up(ui_tree_t* tree, float x, float y);
+
+#endif  // UI_TREE_H
@@ -17,30 +17,6 @@ static bool text_create(window_t* window) {
         return false;
     }
 
-    const char* base = SDL_GetBasePath();
-    if (base == NULL || base[0] == '\0') {
-        base = "./";
-    }
-
-    char font_path[512];
-    if (SDL_snprintf(font_path, sizeof(font_path), "%sassets/fonts/Segoe UI.ttf", base) <= 0) {
-        SDL_Log("Failed to build font path");
-        TTF_DestroyRendererTextEngine(window->ttf_text_engine);
-        window->ttf_text_engine = NULL;
-        TTF_Quit();
-        return false;
-    }
-
-    window->ttf_font_default = TTF_OpenFont(font_path, 16);
-    if (window->ttf_font_default == NULL) {
-        SDL_Log("Failed to load font '%s': %s", font_path, SDL_GetError());
-        TTF_DestroyRendererTextEngine(window->ttf_text_engine);
-        window->ttf_text_engine = NULL;
-        TTF_Quit();
-        return false;
-    }
-
-    SDL_Log("Successfully initialized text rendering (font: Segoe UI, size: 16)");
     return true;
 }
 
@@ -52,6 +28,10 @@ static void text_destroy(window_t* window) {
         window->ttf_font_default = NULL;
     }
 
+    // The font reads from its data until closed.
+    SDL_free(window->ttf_font_data);
+    window->ttf_font_data = NULL;
+
     if (window->ttf_text_engine != NULL) {
         TTF_DestroyRendererTextEngine(window->ttf_text_engine);
         window->ttf_text_engine = NULL;
@@ -62,7 +42,16 @@ static void text_destroy(window_t* window) {
     }
 }
 
-bool window_create(window_t* window, const char* title, int width, int height) {
+static float get_display_scale(SDL_Window* sdl_window) {
+    const float scale = SDL_GetWindowDisplayScale(sdl_window);
+    if (scale <= 0.0f) {
+        SDL_Log("Failed to query display scale, assuming 1: %s", SDL_GetError());
+        return 1.0f;
+    }
+    return scale;
+}
+
+bool window_create(window_t* window, const char* title, int width, int height, bool fullscreen) {
     SDL_assert(window != NULL);
     SDL_assert(title != NULL);
     SDL_assert(width > 0);
@@ -73,7 +62,10 @@ bool window_create(window_t* window, const char* title, int width, int height) {
 
     window->ttf_text_engine = NULL;
     window->ttf_font_default = NULL;
+    window->ttf_font_data = NULL;
 
+    window->display_scale = 1.0f;
+    window->is_fullscreen = fullscreen;
     window->is_running = false;
 
     if (SDL_Init(SDL_INIT_VIDEO) == false) {
@@ -81,19 +73,29 @@ bool window_create(window_t* window, const char* title, int width, int height) {
         return false;
     }
 
-    if (SDL_CreateWindowAndRenderer(title, width, height, 0, &window->sdl_window, &window->sdl_renderer) == false) {
+    SDL_WindowFlags flags = SDL_WINDOW_RESIZABLE | SDL_WINDOW_HIGH_PIXEL_DENSITY;
+    if (fullscreen == true) {
+        flags |= SDL_WINDOW_FULLSCREEN;
+    }
+
+    if (SDL_CreateWindowAndRenderer(title, width, height, flags, &window->sdl_window, &window->sdl_renderer) ==
+        false) {
         SDL_Log("Failed to create window and renderer: %s", SDL_GetError());
         SDL_Quit();
         return false;
     }
 
-    SDL_Log("Successfully created window: %s (%dx%d)", title, width, height);
+    if (SDL_SetWindowMinimumSize(window->sdl_window, WINDOW_MIN_WIDTH, WINDOW_MIN_HEIGHT) == false) {
+        SDL_Log("Warning: Failed to set minimum window size: %s", SDL_GetError());
+    }
+
+    window->display_scale = get_display_scale(window->sdl_window);
+    SDL_Log("Successfully created window: %s (%dx%d%s)", title, width, height, fullscreen ? ", fullscreen" : "");
 
-    window->time.frame_first = SDL_GetTicks();
+    window->time.frame_first = SDL_GetTicksNS();
     window->time.frame_last = window->time.frame_first;
     window->time.frame_delta = 0;
-    window->time.accumulator = 0;
-    window->time.frame_accumulated = false;
+    timestep_init(&window->time.step, WINDOW_TICK_RATE, 1, WINDOW_MAX_TICKS_PER_FRAME, window->time.frame_first);
 
     if (text_create(window) == false) {
         window_destroy(window);
@@ -111,8 +113,7 @@ void window_destroy(window_t* window) {
     window->time.frame_first = 0;
     window->time.frame_last = 0;
     window->time.frame_delta = 0;
-    window->time.accumulator = 0;
-    window->time.frame_accumulated = false;
+    timestep_reset(&window->time.step, 0);
 
     if (window->sdl_renderer != NULL) {
         SDL_DestroyRenderer(window->sdl_renderer);
@@ -127,31 +128,92 @@ void window_destroy(window_t* window) {
     SDL_Quit();
 }
 
-bool window_can_update_fixed(window_t* window, const Uint64 tick_interval) {
+bool window_open_font(window_t* window, void* data, size_t size) {
     SDL_assert(window != NULL);
-    SDL_assert(tick_interval > 0);
+    SDL_assert(window->ttf_text_engine != NULL);
+    SDL_assert(window->ttf_font_default == NULL);
+    SDL_assert(data != NULL);
+
+    SDL_IOStream* io = SDL_IOFromConstMem(data, size);
+    if (io == NULL) {
+        SDL_Log("Failed to open font data: %s", SDL_GetError());
+        SDL_free(data);
+        return false;
+    }
 
-    const Uint64 time_current = SDL_GetTicks();
+    window->ttf_font_default = TTF_OpenFontIO(io, true, WINDOW_FONT_SIZE * window->display_scale);
+    if (window->ttf_font_default == NULL) {
+        SDL_Log("Failed to load font: %s", SDL_GetError());
+        SDL_free(data);
+        return false;
+    }
+    window->ttf_font_data = data;
 
-    if (window->time.frame_accumulated == true && time_current > window->time.frame_last) {
-        window->time.frame_accumulated = false;
+    SDL_Log("Successfully loaded font (%zu bytes, size: %.0f, scale: %.2f)", size, WINDOW_FONT_SIZE,
+            window->display_scale);
+    return true;
+}
+
+bool window_set_vsync(window_t* window, bool enabled) {
+    SDL_assert(window != NULL);
+    SDL_assert(window->sdl_renderer != NULL);
+
+    if (SDL_SetRenderVSync(window->sdl_renderer, enabled ? 1 : SDL_RENDERER_VSYNC_DISABLED) == false) {
+        SDL_Log("Failed to %s vsync: %s", enabled ? "enable" : "disable", SDL_GetError());
+        return false;
     }
 
-    if (window->time.frame_accumulated == false) {
-        window->time.frame_delta = time_current - window->time.frame_last;
-        window->time.frame_last = time_current;
-        window->time.accumulator += window->time.frame_delta;
-        window->time.frame_accumulated = true;
+    return true;
+}
+
+bool window_set_fullscreen(window_t* window, bool fullscreen) {
+    SDL_assert(window != NULL);
+    SDL_assert(window->sdl_window != NULL);
+
+    if (SDL_SetWindowFullscreen(window->sdl_window, fullscreen) == false) {
+        SDL_Log("Failed to %s fullscreen: %s", fullscreen ? "enter" : "leave", SDL_GetError());
+        return false;
     }
 
-    if (window->time.accumulator >= tick_interval) {
-        window->time.accumulator -= tick_interval;
-        if (window->time.accumulator < tick_interval) {
-            window->time.frame_accumulated = false;
-        }
+    window->is_fullscreen = fullscreen;
+    return true;
+}
+
+bool window_update_display_scale(window_t* window) {
+    SDL_assert(window != NULL);
+    SDL_assert(window->sdl_window != NULL);
+    SDL_assert(window->ttf_font_default != NULL);
+
+    const float scale = get_display_scale(window->sdl_window);
+    if (scale == window->display_scale) {
         return true;
     }
 
-    window->time.frame_accumulated = false;
-    return false;
+    // Text objects created from the font lay themselves out again on next use.
+    if (TTF_SetFontSize(window->ttf_font_default, WINDOW_FONT_SIZE * scale) == false) {
+        SDL_Log("Failed to resize font for display scale %.2f: %s", scale, SDL_GetError());
+        return false;
+    }
+
+    SDL_Log("Display scale changed to %.2f", scale);
+    window->display_scale = scale;
+    return true;
+}
+
+int window_begin_frame(window_t* window) {
+    SDL_assert(window != NULL);
+
+    const Uint64 time_current = SDL_GetTicksNS();
+    window->time.frame_delta = time_current - window->time.frame_last;
+    window->time.frame_last = time_current;
+
+    return timestep_advance(&window->time.step, time_current);
+}
+
+void window_reset_fixed(window_t* window) {
+    SDL_assert(window != NULL);
+
+    window->time.frame_last = SDL_GetTicksNS();
+    window->time.frame_delta = 0;
+    timestep_reset(&window->time.step, window->time.frame_last);
 }
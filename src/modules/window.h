@@ -4,22 +4,31 @@
 #include <SDL3/SDL.h>
 #include <SDL3_ttf/SDL_ttf.h>
 
+#include "timestep.h"
+
+/* Initial window size, and the smallest it can be resized to, in window coordinates. The menus need the minimum. */
 #define WINDOW_WIDTH 500
 #define WINDOW_HEIGHT 500
+#define WINDOW_MIN_WIDTH 420
+#define WINDOW_MIN_HEIGHT 320
+
+/* Size of the default font at a display scale of 1. */
+#define WINDOW_FONT_SIZE 16.0f
 
+/* Ticks per second until the game sets its own rate with timestep_set_rate(). */
 #define WINDOW_TICK_RATE 8
-#define WINDOW_TICK_INTERVAL (1000 / WINDOW_TICK_RATE)
+/* Catch-up ticks allowed per frame after a stall, see timestep_t. */
+#define WINDOW_MAX_TICKS_PER_FRAME 4
 
 /**
  * @brief Time related data for the window.
- * @note All time values are in milliseconds.
+ * @note All time values are in nanoseconds.
  */
 typedef struct {
     Uint64 frame_first;
     Uint64 frame_last;
     Uint64 frame_delta;
-    Uint64 accumulator;
-    bool frame_accumulated;
+    timestep_t step;
 } window_timing_t;
 
 /**
@@ -31,26 +40,74 @@ typedef struct {
 
     TTF_TextEngine* ttf_text_engine;
     TTF_Font* ttf_font_default;
+    /* File contents ttf_font_default reads glyphs from, owned by the window. */
+    void* ttf_font_data;
+
+    /* Pixels per window coordinate times the desktop's scale setting. Everything is drawn in pixels, so text and
+     * layout spacing are multiplied by this to keep their apparent size on high-DPI displays. */
+    float display_scale;
+    bool is_fullscreen;
 
     window_timing_t time;
 
     bool is_running;
 } window_t;
 
-bool window_create(window_t* window, const char* title, int width, int height);
+/**
+ * @brief Open a resizable, high-DPI aware window with a renderer and a text engine.
+ *
+ * The renderer draws in pixels, at the display's native resolution; see window_t::display_scale. No font is open
+ * yet, so the font file can still be loading elsewhere; see window_open_font().
+ */
+bool window_create(window_t* window, const char* title, int width, int height, bool fullscreen);
 void window_destroy(window_t* window);
 
 /**
- * @brief Determines if it's time for a fixed update based on the tick interval.
+ * @brief Open the default font from a font file's contents, sized for the current display scale.
+ *
+ * @param data Contents of a TrueType file, allocated with SDL_malloc(). The window takes ownership even on failure.
+ * @return false if the data is not a usable font.
+ */
+bool window_open_font(window_t* window, void* data, size_t size);
+
+/**
+ * @brief Switch between fullscreen and a normal window.
+ *
+ * @return false if the window system refused the change.
+ */
+bool window_set_fullscreen(window_t* window, bool fullscreen);
+
+/**
+ * @brief Re-read the display scale, e.g. after the window moved to another monitor, and resize the font to match.
+ *
+ * Text measured or rasterized before the call is stale afterwards.
+ *
+ * @return false if the font could not be resized.
+ */
+bool window_update_display_scale(window_t* window);
+
+/**
+ * @brief Turn presentation sync to the display's refresh on or off.
+ *
+ * @return false if the renderer does not support the requested mode.
+ */
+bool window_set_vsync(window_t* window, bool enabled);
+
+/**
+ * @brief Start a new frame and work out how many fixed updates it should run.
  *
  * Since some frames run faster than others, updating your game logic each frame
- * leads to inconsistent behavior. This function helps maintain a consistent
- * update rate at a fixed interval.
+ * leads to inconsistent behavior. The game instead advances in ticks of a fixed
+ * length, as many per frame as the time since the previous frame covers.
  *
  * @param window Pointer to the window state.
- * @param tick_interval The desired fixed interval between ticks in milliseconds.
- * @return true if it's time for an update, false otherwise.
+ * @return The number of fixed updates to run, at most WINDOW_MAX_TICKS_PER_FRAME.
+ */
+int window_begin_frame(window_t* window);
+
+/**
+ * @brief Drop any time accumulated towards fixed updates, e.g. after the loop slept waiting for input.
  */
-bool window_can_update_fixed(window_t* window, Uint64 tick_interval);
+void window_reset_fixed(window_t* window);
 
 #endif  // WINDOW_H
@@ -1,13 +1,25 @@
 #include "snake.h"
 
 #include <stdint.h>
+#include <stdio.h>
 #include <string.h>
 #include <SDL3/SDL_log.h>
 
 #include "game/snake_state.h"
 #include "game/snake_hud.h"
+#include "game/snake_menu.h"
 #include "modules/config.h"
 
+SDL_COMPILE_TIME_ASSERT(snake_grid_min_matches_config, SNAKE_SIM_GRID_MIN == CONFIG_GRID_SIZE_MIN);
+SDL_COMPILE_TIME_ASSERT(snake_grid_max_matches_config, SNAKE_SIM_GRID_MAX == CONFIG_GRID_SIZE_MAX);
+
+/* Frame cap used when vsync was asked for but the renderer cannot provide it, and no explicit cap is set. */
+static const int k_fallback_fps_cap = 60;
+
+static const char* const k_latency_report_filename = "latency.txt";
+static const char* const k_font_filename = "assets/fonts/Segoe UI.ttf";
+static const char* const k_eat_sound_filename = "assets/sounds/bubble-pop.wav";
+
 static bool build_asset_path(const char* relative, char* out, size_t out_size) {
     const char* base = SDL_GetBasePath();
     if (base == NULL || base[0] == '\0') {
@@ -21,6 +33,55 @@ static bool build_asset_path(const char* relative, char* out, size_t out_size) {
     return true;
 }
 
+/**
+ * @brief Worker side of the font load: read the file. FreeType parses it on the main thread, where the text engine
+ *        lives, in window_open_font().
+ */
+static bool load_font_file(void* user_data) {
+    snake_assets_t* const assets = (snake_assets_t*)user_data;
+
+    assets->font_data = SDL_LoadFile(assets->font_path, &assets->font_size);
+    if (assets->font_data == NULL) {
+        SDL_Log("Failed to read font '%s': %s", assets->font_path, SDL_GetError());
+        return false;
+    }
+    return true;
+}
+
+static bool load_eat_sound(void* user_data) {
+    snake_assets_t* const assets = (snake_assets_t*)user_data;
+    return audio_decode_sound(assets->eat_sound_path, &assets->eat_sound);
+}
+
+/**
+ * @brief Start reading the font and decoding the sound, so both overlap with the window and audio device coming up.
+ */
+static void assets_start(snake_assets_t* assets) {
+    asset_loader_init(&assets->loader);
+    assets->font_job = -1;
+    assets->eat_sound_job = -1;
+
+    if (build_asset_path(k_font_filename, assets->font_path, sizeof(assets->font_path)) == true) {
+        assets->font_job = asset_loader_start(&assets->loader, load_font_file, assets, "font loader");
+    }
+    if (build_asset_path(k_eat_sound_filename, assets->eat_sound_path, sizeof(assets->eat_sound_path)) == true) {
+        assets->eat_sound_job = asset_loader_start(&assets->loader, load_eat_sound, assets, "sound loader");
+    }
+    if (assets->eat_sound_job == -1) {
+        SDL_Log("Warning: Failed to load eating sound effect");
+    }
+}
+
+static void assets_destroy(snake_assets_t* assets) {
+    // Loads still running write into assets, so wait for them before freeing what they left.
+    asset_loader_destroy(&assets->loader);
+
+    SDL_free(assets->font_data);
+    assets->font_data = NULL;
+    SDL_free(assets->eat_sound.buffer);
+    assets->eat_sound.buffer = NULL;
+}
+
 bool snake_create(snake_t* snake, const char* title) {
     SDL_assert(snake != NULL);
     SDL_assert(title != NULL);
@@ -29,38 +90,64 @@ bool snake_create(snake_t* snake, const char* title) {
 
     memset(snake, 0, sizeof(*snake));
 
-    if (window_create(&snake->window, title, WINDOW_WIDTH, WINDOW_HEIGHT) == false) {
+    if (config_load(&snake->config) == false) {
+        SDL_Log("Warning: Failed to load config, continuing with defaults");
+        config_set_defaults(&snake->config);
+    }
+
+    assets_start(&snake->assets);
+
+    if (window_create(&snake->window, title, WINDOW_WIDTH, WINDOW_HEIGHT, snake->config.fullscreen) == false) {
         SDL_Log("Failed to create game window");
+        assets_destroy(&snake->assets);
         return false;
     }
 
-    if (config_load(&snake->config) == false) {
-        SDL_Log("Warning: Failed to load config, continuing with defaults");
-        config_set_defaults(&snake->config);
+    int fps_cap = snake->config.fps_cap;
+    if (snake->config.vsync == true && window_set_vsync(&snake->window, true) == false && fps_cap == 0) {
+        SDL_Log("Warning: vsync unavailable, capping at %d FPS instead", k_fallback_fps_cap);
+        fps_cap = k_fallback_fps_cap;
     }
+    frame_pacer_init(&snake->pacer, fps_cap);
+    snake_get_speed_from_config(&snake->config, &snake->speed);
 
     if (audio_manager_create(&snake->audio) == false) {
         SDL_Log("Warning: Failed to initialize audio, continuing without sound");
     } else {
         snake_apply_audio_settings(snake);
-        char eat_sound_path[512];
-        if (build_asset_path("assets/sounds/bubble-pop.wav", eat_sound_path, sizeof(eat_sound_path)) == false ||
-            audio_manager_load_sound(&snake->audio, SOUND_EAT_FOOD, eat_sound_path) == false) {
-            SDL_Log("Warning: Failed to load eating sound effect");
-        }
     }
 
+    // Nothing can be drawn without the font; the sound is taken over later by snake_poll_assets().
+    if (snake->assets.font_job == -1 || asset_loader_wait(&snake->assets.loader, snake->assets.font_job) == false) {
+        SDL_Log("Failed to load font");
+        goto fail;
+    }
+    // The window owns the font data from here on, whether or not it opens.
+    if (window_open_font(&snake->window, snake->assets.font_data, snake->assets.font_size) == false) {
+        snake->assets.font_data = NULL;
+        goto fail;
+    }
+    snake->assets.font_data = NULL;
+
     Uint64 seed = SDL_GetTicksNS();
     seed ^= SDL_GetPerformanceCounter();
     seed ^= (Uint64)(uintptr_t)snake;
     if (seed == 0) {
         seed = SDL_GetPerformanceCounter() | 1u;
     }
-    SDL_srand(seed);
+
+    snake_sim_init(&snake->sim);
+    snake_input_queue_init(&snake->input_queue);
+    snake_latency_init(&snake->latency);
+    snake_sim_seed(&snake->sim, seed);
     SDL_Log("RNG initialized with seed: %llu", (unsigned long long)seed);
+    if (snake_sim_create(&snake->sim, snake->config.grid_width, snake->config.grid_height, true) == false) {
+        SDL_Log("Failed to create %dx%d game grid", snake->config.grid_width, snake->config.grid_height);
+        goto fail;
+    }
 
-    dynamic_array_init(&snake->array_food);
-    dynamic_array_init(&snake->array_body);
+    snake_board_init(&snake->board);
+    ui_tree_init(&snake->menu_cache.ui);
 
     if (snake_hud_create(&snake->hud, &snake->window, &snake->config) == false) {
         SDL_Log("Failed to initialize HUD resources");
@@ -74,8 +161,6 @@ bool snake_create(snake_t* snake, const char* title) {
 
     snake->state = SNAKE_STATE_START;
     snake->options_return_state = SNAKE_STATE_START;
-    snake->options_dragging_volume = false;
-    snake->options_dragging_resume = false;
     snake_hud_start_menu_fade(&snake->hud);
 
     SDL_Log("Snake game initialized successfully");
@@ -86,22 +171,76 @@ fail:
     return false;
 }
 
+/**
+ * @brief Write the latency histograms next to the executable, if any turn was measured.
+ */
+static void write_latency_report(const snake_t* snake) {
+    if (snake->latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK].count == 0) {
+        return;
+    }
+
+    char path[512];
+    if (build_asset_path(k_latency_report_filename, path, sizeof(path)) == false) {
+        return;
+    }
+
+    FILE* file = fopen(path, "w");
+    if (file == NULL) {
+        SDL_Log("Failed to open latency report for writing: %s", path);
+        return;
+    }
+
+    const bool written = snake_latency_write_report(&snake->latency, file);
+    if (fclose(file) != 0 || written == false) {
+        SDL_Log("Failed to write latency report: %s", path);
+        return;
+    }
+    SDL_Log("Latency report written to %s", path);
+}
+
 void snake_destroy(snake_t* snake) {
     SDL_assert(snake != NULL);
 
+    write_latency_report(snake);
+
+    snake_menu_cache_destroy(&snake->menu_cache);
     snake_hud_destroy(&snake->hud);
+    snake_board_destroy(&snake->board);
 
+    assets_destroy(&snake->assets);
     audio_manager_destroy(&snake->audio);
     window_destroy(&snake->window);
 
-    vector2i_set(&snake->position_head, 0, 0);
-    vector2i_set(&snake->previous_position_head, 0, 0);
-    vector2i_set(&snake->previous_position_tail, 0, 0);
+    snake_sim_destroy(&snake->sim);
+}
+
+void snake_poll_assets(snake_t* snake) {
+    SDL_assert(snake != NULL);
 
-    snake->current_direction = SNAKE_DIRECTION_UP;
+    snake_assets_t* const assets = &snake->assets;
+    if (asset_loader_is_idle(&assets->loader) == true) {
+        return;
+    }
 
-    dynamic_array_destroy(&snake->array_food);
-    dynamic_array_destroy(&snake->array_body);
+    bool success = false;
+    int job = -1;
+    while ((job = asset_loader_poll(&assets->loader, &success)) != -1) {
+        if (job != assets->eat_sound_job) {
+            continue;
+        }
+
+        if (success == false) {
+            SDL_Log("Warning: Failed to load eating sound effect");
+        } else if (snake->audio.is_initialized == false) {
+            SDL_free(assets->eat_sound.buffer);
+            assets->eat_sound.buffer = NULL;
+        } else {
+            const size_t length = assets->eat_sound.length;
+            if (audio_manager_set_sound(&snake->audio, SOUND_EAT_FOOD, &assets->eat_sound) == true) {
+                SDL_Log("Successfully loaded sound: %s (%zu bytes)", assets->eat_sound_path, length);
+            }
+        }
+    }
 }
 
 bool snake_apply_audio_settings(snake_t* snake) {
@@ -121,3 +260,14 @@ bool snake_save_config(snake_t* snake) {
     SDL_assert(snake != NULL);
     return config_save(&snake->config);
 }
+
+void snake_get_speed_from_config(const game_config_t* config, snake_speed_t* out_speed) {
+    SDL_assert(config != NULL);
+    SDL_assert(out_speed != NULL);
+
+    // Loaded configs are normalized, so these are already in the ranges snake_speed_t expects.
+    out_speed->curve = config->speed_curve;
+    out_speed->base_rate = config->tick_rate;
+    out_speed->max_rate = config->tick_rate_max;
+    out_speed->score_step = config->speed_step;
+}
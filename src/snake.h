@@ -2,23 +2,18 @@
 #define SNAKE_H
 
 #include "modules/window.h"
+#include "modules/asset_loader.h"
 #include "modules/audio.h"
 #include "modules/config.h"
-#include "utils/vector.h"
-#include "utils/dynamic_array.h"
+#include "modules/frame_pacer.h"
+#include "modules/ui_tree.h"
+#include "core/snake_input_queue.h"
+#include "core/snake_latency.h"
+#include "core/snake_sim.h"
+#include "core/snake_speed.h"
+#include "game/snake_board.h"
 #include "game/snake_hud.h"
-
-#define SNAKE_CELL_SIZE 10
-
-#define SNAKE_GRID_X (WINDOW_WIDTH / SNAKE_CELL_SIZE)
-#define SNAKE_GRID_Y (WINDOW_HEIGHT / SNAKE_CELL_SIZE)
-
-typedef enum {
-    SNAKE_DIRECTION_UP,
-    SNAKE_DIRECTION_DOWN,
-    SNAKE_DIRECTION_LEFT,
-    SNAKE_DIRECTION_RIGHT
-} snake_direction_t;
+#include "game/snake_menu_layout.h"
 
 typedef enum {
     SNAKE_STATE_START,
@@ -29,36 +24,79 @@ typedef enum {
     SNAKE_STATE_OPTIONS
 } snake_game_state_t;
 
-typedef enum { SNAKE_CELL_EMPTY, SNAKE_CELL_WALL, SNAKE_CELL_FOOD, SNAKE_CELL_SNAKE } snake_cell_state_t;
-
+/**
+ * @brief The start, pause, resume and game-over menu's layout and its composed render target, the options menu's
+ *        layout, and the widget tree both are hit-tested through, kept across frames.
+ *
+ * All are rebuilt only when the menu being shown, its text (snake_hud_t::text_revision) or the output size changes;
+ * fading just modulates the texture. The layer is also recomposed when the hovered button changes.
+ */
+typedef struct {
+    SDL_Texture* texture;
+    vector2i_t size;
+    snake_game_state_t state;
+    Uint64 text_revision;
+    int hovered_id;
+    bool is_valid;
+
+    snake_menu_layout_t layout;
+    snake_game_state_t layout_state;
+    Uint64 layout_text_revision;
+    bool has_layout;
+
+    snake_options_layout_t options_layout;
+    Uint64 options_text_revision;
+    bool has_options_layout;
+
+    /* Widgets of the menu snake->state shows, with ids from snake_ui_widget_t. */
+    ui_tree_t ui;
+    snake_game_state_t ui_state;
+    Uint64 ui_text_revision;
+    bool has_ui;
+} snake_menu_cache_t;
+
+/**
+ * @brief Assets loading on worker threads since snake_create() started, and the results each load leaves until the
+ *        main thread takes them over.
+ *
+ * The font is needed before anything can be drawn, so snake_create() waits for it; the sound is picked up by
+ * snake_poll_assets() whenever it is ready, and is simply not heard until then.
+ */
 typedef struct {
-    vector2i_t position;
-    snake_cell_state_t state;
-    SDL_Color render_color;
-} snake_cell_t;
+    asset_loader_t loader;
+
+    char font_path[512];
+    void* font_data;
+    size_t font_size;
+    int font_job;
+
+    char eat_sound_path[512];
+    sound_data_t eat_sound;
+    int eat_sound_job;
+} snake_assets_t;
 
 typedef struct {
     window_t window;
+    frame_pacer_t pacer;
     audio_manager_t audio;
     game_config_t config;
+    snake_assets_t assets;
 
     snake_hud_t hud;
+    snake_board_t board;
+    snake_menu_cache_t menu_cache;
 
     snake_game_state_t state;
     snake_game_state_t options_return_state;
-    bool options_dragging_volume;
-    bool options_dragging_resume;
 
-    snake_direction_t current_direction;
+    snake_sim_t sim;
+    snake_speed_t speed;
+    /* Turns pressed but not yet applied; snake_update_fixed() takes one per tick. */
+    snake_input_queue_t input_queue;
 
-    vector2i_t position_head;
-    vector2i_t previous_position_head;
-    vector2i_t previous_position_tail;
-
-    snake_cell_t cells[SNAKE_GRID_X][SNAKE_GRID_Y];
-
-    dynamic_array_t array_food;
-    dynamic_array_t array_body;
+    /* How long turns take from key press to screen, recorded always and written out by snake_destroy(). */
+    snake_latency_t latency;
+    bool show_latency_overlay;
 
     Uint64 resume_countdown_end_ms;
     int resume_countdown_value;
@@ -69,6 +107,23 @@ void snake_destroy(snake_t* snake);
 bool snake_apply_audio_settings(snake_t* snake);
 bool snake_save_config(snake_t* snake);
 
+/**
+ * @brief Build the speed curve a normalized config describes.
+ */
+void snake_get_speed_from_config(const game_config_t* config, snake_speed_t* out_speed);
+
+/**
+ * @brief Check whether the next frame could differ from the last one without any input arriving.
+ *
+ * False on a menu whose fade-in has finished, where the main loop can sleep until the next event.
+ */
+bool snake_is_animating(const snake_t* snake);
+
+/**
+ * @brief Take over assets that finished loading in the background since the last call. Cheap once all are in.
+ */
+void snake_poll_assets(snake_t* snake);
+
 void snake_handle_events(snake_t* snake);
 void snake_update_fixed(snake_t* snake);
 void snake_render_frame(snake_t* snake);
@@ -0,0 +1,105 @@
+#include "snake_headless.h"
+
+#include <SDL3/SDL_assert.h>
+#include <SDL3/SDL_log.h>
+#include <SDL3/SDL_timer.h>
+
+#include "snake.h"
+#include "core/snake_input_queue.h"
+#include "core/snake_sim.h"
+#include "core/snake_speed.h"
+#include "modules/config.h"
+#include "utils/rng.h"
+
+/* The steering picks a random direction on one tick in this many, so rounds neither end at once nor run forever. */
+static const uint32_t k_turn_odds = 8;
+
+static Uint64 get_tick_interval_ns(const snake_speed_t* speed, size_t score) {
+    const snake_tick_rate_t rate = snake_speed_get_rate(speed, score);
+    return SDL_NS_PER_SECOND * rate.denominator / rate.numerator;
+}
+
+bool snake_headless_run(const snake_headless_options_t* options) {
+    SDL_assert(options != NULL);
+
+    game_config_t config;
+    if (config_load(&config) == false) {
+        SDL_Log("Warning: Failed to load config, continuing with defaults");
+        config_set_defaults(&config);
+    }
+
+    snake_speed_t speed;
+    snake_get_speed_from_config(&config, &speed);
+
+    snake_sim_t sim;
+    snake_sim_init(&sim);
+    snake_sim_seed(&sim, options->seed);
+    if (snake_sim_create(&sim, config.grid_width, config.grid_height, false) == false ||
+        snake_sim_reset(&sim) == false) {
+        SDL_Log("Failed to create %dx%d headless game", config.grid_width, config.grid_height);
+        snake_sim_destroy(&sim);
+        return false;
+    }
+
+    // Steering draws from its own sequence so it does not shift where food spawns.
+    rng_t steering;
+    rng_seed(&steering, options->seed ^ 0x9E3779B97F4A7C15ull);
+    // Turns go through the same queue as keyboard input, so the bot is held to the same one-turn-per-tick rule.
+    snake_input_queue_t input_queue;
+    snake_input_queue_init(&input_queue);
+
+    Uint64 rounds = 0;
+    size_t best_score = 0;
+    Uint64 game_time = 0;
+    Uint64 tick_interval = get_tick_interval_ns(&speed, 0);
+    bool success = true;
+
+    const Uint64 start = SDL_GetTicksNS();
+    for (Uint64 tick = 0; tick < options->tick_count; ++tick) {
+        if (rng_next_bounded(&steering, k_turn_odds) == 0) {
+            snake_input_queue_push(&input_queue, (snake_direction_t)rng_next_bounded(&steering, 4), game_time);
+        }
+        snake_input_queue_apply_next(&input_queue, &sim, NULL);
+
+        snake_sim_event_t event;
+        if (snake_sim_step(&sim, &event) == false) {
+            success = false;
+            break;
+        }
+        game_time += tick_interval;
+
+        if (event == SNAKE_SIM_EVENT_ATE_FOOD) {
+            tick_interval = get_tick_interval_ns(&speed, snake_sim_get_score(&sim));
+        } else if (event == SNAKE_SIM_EVENT_COLLISION) {
+            const size_t score = snake_sim_get_score(&sim);
+            if (score > best_score) {
+                best_score = score;
+            }
+            ++rounds;
+            snake_input_queue_clear(&input_queue);
+            if (snake_sim_reset(&sim) == false) {
+                success = false;
+                break;
+            }
+            tick_interval = get_tick_interval_ns(&speed, 0);
+        }
+    }
+    const Uint64 elapsed = SDL_GetTicksNS() - start;
+
+    if (snake_sim_get_score(&sim) > best_score) {
+        best_score = snake_sim_get_score(&sim);
+    }
+    snake_sim_destroy(&sim);
+
+    if (success == false) {
+        SDL_Log("Headless run stopped early");
+        return false;
+    }
+
+    const double seconds = (double)elapsed / (double)SDL_NS_PER_SECOND;
+    SDL_Log("Headless run: %llu ticks in %.3f s (%.0f ticks/s), %llu rounds finished, best score %zu",
+            (unsigned long long)options->tick_count, seconds,
+            seconds > 0.0 ? (double)options->tick_count / seconds : 0.0, (unsigned long long)rounds, best_score);
+    SDL_Log("That is %.1f s of play at the configured speed", (double)game_time / (double)SDL_NS_PER_SECOND);
+    return true;
+}
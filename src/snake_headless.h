@@ -0,0 +1,25 @@
+#ifndef SNAKE_HEADLESS_H
+#define SNAKE_HEADLESS_H
+
+#include <stdbool.h>
+#include <SDL3/SDL_stdinc.h>
+
+/**
+ * @brief Settings for a run without a window, renderer or audio.
+ */
+typedef struct {
+    Uint64 tick_count;
+    Uint64 seed;
+} snake_headless_options_t;
+
+/**
+ * @brief Step the game as fast as it goes, with the grid and speed curve from the saved config, and log the results.
+ *
+ * The tick rate does not pace anything here. It is only used to report how much game time the run covered at the
+ * configured speed. A fixed seed gives the same run every time. Rounds restart as soon as the snake dies.
+ *
+ * @return false if the simulation could not be created or failed while stepping.
+ */
+bool snake_headless_run(const snake_headless_options_t* options);
+
+#endif  // SNAKE_HEADLESS_H
@@ -0,0 +1,180 @@
+#include "ring_buffer.h"
+
+#include <assert.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL_log.h>
+
+static bool ring_buffer_can_allocate(size_t data_size, size_t capacity) {
+    return data_size <= (SIZE_MAX / capacity);
+}
+
+static size_t ring_buffer_physical_index(const ring_buffer_t* buffer, size_t index) {
+    size_t physical = buffer->front + index;
+    if (physical >= buffer->capacity) {
+        physical -= buffer->capacity;
+    }
+    return physical;
+}
+
+static void* ring_buffer_slot(const ring_buffer_t* buffer, size_t physical) {
+    return (char*)buffer->data + (physical * buffer->data_size);
+}
+
+void ring_buffer_init(ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+
+    buffer->data = NULL;
+    buffer->data_size = 0;
+    buffer->front = 0;
+    buffer->size = 0;
+    buffer->capacity = 0;
+}
+
+bool ring_buffer_create(ring_buffer_t* buffer, size_t data_size, size_t initial_capacity) {
+    assert(buffer != NULL);
+    assert(data_size > 0);
+    assert(initial_capacity > 0);
+
+    if (ring_buffer_can_allocate(data_size, initial_capacity) == false) {
+        SDL_Log("Ring buffer allocation would overflow (element_size=%zu, capacity=%zu)", data_size, initial_capacity);
+        return false;
+    }
+
+    buffer->data_size = data_size;
+    buffer->front = 0;
+    buffer->size = 0;
+    buffer->capacity = initial_capacity;
+    buffer->data = malloc(data_size * initial_capacity);
+
+    if (buffer->data == NULL) {
+        SDL_Log("Failed to allocate ring buffer (element_size=%zu, capacity=%zu)", data_size, initial_capacity);
+        buffer->data_size = 0;
+        buffer->capacity = 0;
+        return false;
+    }
+
+    return true;
+}
+
+void ring_buffer_destroy(ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+
+    if (buffer->data != NULL) {
+        free(buffer->data);
+
+        buffer->data = NULL;
+        buffer->data_size = 0;
+        buffer->front = 0;
+        buffer->size = 0;
+        buffer->capacity = 0;
+    }
+}
+
+/**
+ * @brief Double the capacity, unwrapping the elements that wrapped past the end of the old allocation.
+ */
+static bool ring_buffer_grow(ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+
+    const size_t old_capacity = buffer->capacity;
+    const size_t new_capacity = old_capacity > (SIZE_MAX / 2) ? SIZE_MAX : old_capacity * 2;
+    if (new_capacity <= old_capacity || ring_buffer_can_allocate(buffer->data_size, new_capacity) == false) {
+        SDL_Log("Ring buffer resize would overflow (element_size=%zu, capacity=%zu)", buffer->data_size,
+                old_capacity);
+        return false;
+    }
+
+    void* new_data = realloc(buffer->data, buffer->data_size * new_capacity);
+    if (new_data == NULL) {
+        SDL_Log("Failed to resize ring buffer to capacity %zu", new_capacity);
+        return false;
+    }
+
+    buffer->data = new_data;
+    buffer->capacity = new_capacity;
+
+    // Elements in [0, wrapped) logically follow the ones at the end of the old allocation.
+    if (buffer->front + buffer->size > old_capacity) {
+        const size_t wrapped = buffer->front + buffer->size - old_capacity;
+        memcpy(ring_buffer_slot(buffer, old_capacity), buffer->data, wrapped * buffer->data_size);
+    }
+
+    return true;
+}
+
+bool ring_buffer_push_front(ring_buffer_t* buffer, const void* data) {
+    assert(buffer != NULL);
+    assert(buffer->data != NULL);
+    assert(data != NULL);
+
+    if (buffer->size >= buffer->capacity && ring_buffer_grow(buffer) == false) {
+        return false;
+    }
+
+    buffer->front = (buffer->front == 0) ? buffer->capacity - 1 : buffer->front - 1;
+    memcpy(ring_buffer_slot(buffer, buffer->front), data, buffer->data_size);
+
+    buffer->size++;
+    return true;
+}
+
+bool ring_buffer_push_back(ring_buffer_t* buffer, const void* data) {
+    assert(buffer != NULL);
+    assert(buffer->data != NULL);
+    assert(data != NULL);
+
+    if (buffer->size >= buffer->capacity && ring_buffer_grow(buffer) == false) {
+        return false;
+    }
+
+    memcpy(ring_buffer_slot(buffer, ring_buffer_physical_index(buffer, buffer->size)), data, buffer->data_size);
+
+    buffer->size++;
+    return true;
+}
+
+void ring_buffer_pop_back(ring_buffer_t* buffer, void* out_data) {
+    assert(buffer != NULL);
+    assert(buffer->size > 0);
+
+    if (out_data != NULL) {
+        memcpy(out_data, ring_buffer_back(buffer), buffer->data_size);
+    }
+
+    buffer->size--;
+}
+
+void* ring_buffer_get(const ring_buffer_t* buffer, size_t index) {
+    assert(buffer != NULL);
+    assert(index < buffer->size);
+
+    return ring_buffer_slot(buffer, ring_buffer_physical_index(buffer, index));
+}
+
+void* ring_buffer_front(const ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+    assert(buffer->size > 0);
+
+    return ring_buffer_slot(buffer, buffer->front);
+}
+
+void* ring_buffer_back(const ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+    assert(buffer->size > 0);
+
+    return ring_buffer_get(buffer, buffer->size - 1);
+}
+
+bool ring_buffer_is_empty(const ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+    return buffer->size == 0;
+}
+
+void ring_buffer_clear(ring_buffer_t* buffer) {
+    assert(buffer != NULL);
+    buffer->front = 0;
+    buffer->size = 0;
+}
@@ -0,0 +1,45 @@
+#ifndef RING_BUFFER_H
+#define RING_BUFFER_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+/**
+ * @brief Growable circular buffer of fixed-size elements.
+ *
+ * Elements are addressed from the front (index 0) to the back (index size - 1). Pushing to the front and popping
+ * from the back are O(1), so a sequence can slide along without moving the elements in between.
+ */
+typedef struct {
+    void* data;
+    size_t data_size;
+    size_t front;
+    size_t size;
+    size_t capacity;
+} ring_buffer_t;
+
+void ring_buffer_init(ring_buffer_t* buffer);
+
+bool ring_buffer_create(ring_buffer_t* buffer, size_t data_size, size_t initial_capacity);
+void ring_buffer_destroy(ring_buffer_t* buffer);
+
+bool ring_buffer_push_front(ring_buffer_t* buffer, const void* data);
+bool ring_buffer_push_back(ring_buffer_t* buffer, const void* data);
+
+/**
+ * @brief Remove the back element, optionally copying it to out_data.
+ */
+void ring_buffer_pop_back(ring_buffer_t* buffer, void* out_data);
+
+void* ring_buffer_get(const ring_buffer_t* buffer, size_t index);
+void* ring_buffer_front(const ring_buffer_t* buffer);
+void* ring_buffer_back(const ring_buffer_t* buffer);
+
+bool ring_buffer_is_empty(const ring_buffer_t* buffer);
+
+/**
+ * @brief Reset size to 0 while keeping the allocated buffer (no reallocation).
+ */
+void ring_buffer_clear(ring_buffer_t* buffer);
+
+#endif  // RING_BUFFER_H
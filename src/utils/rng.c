@@ -0,0 +1,48 @@
+#include "rng.h"
+
+#include <assert.h>
+#include <stddef.h>
+
+static const uint64_t k_pcg_multiplier = 6364136223846793005ULL;
+
+/* Fixed stream selector; instances are told apart by their seed. */
+static const uint64_t k_pcg_stream = 0xda3e39cb94b95bdbULL;
+
+void rng_seed(rng_t* rng, uint64_t seed) {
+    assert(rng != NULL);
+
+    rng->state = 0;
+    rng->increment = (k_pcg_stream << 1u) | 1u;
+    (void)rng_next_u32(rng);
+    rng->state += seed;
+    (void)rng_next_u32(rng);
+}
+
+uint32_t rng_next_u32(rng_t* rng) {
+    assert(rng != NULL);
+
+    const uint64_t old_state = rng->state;
+    rng->state = old_state * k_pcg_multiplier + rng->increment;
+
+    const uint32_t xorshifted = (uint32_t)(((old_state >> 18u) ^ old_state) >> 27u);
+    const uint32_t rotation = (uint32_t)(old_state >> 59u);
+    return (xorshifted >> rotation) | (xorshifted << ((0u - rotation) & 31u));
+}
+
+uint32_t rng_next_bounded(rng_t* rng, uint32_t bound) {
+    assert(rng != NULL);
+    assert(bound > 0);
+
+    // Multiply-shift maps the 32-bit output onto [0, bound); reject the few low products that would bias it.
+    uint64_t product = (uint64_t)rng_next_u32(rng) * bound;
+    uint32_t low = (uint32_t)product;
+    if (low < bound) {
+        const uint32_t threshold = (0u - bound) % bound;
+        while (low < threshold) {
+            product = (uint64_t)rng_next_u32(rng) * bound;
+            low = (uint32_t)product;
+        }
+    }
+
+    return (uint32_t)(product >> 32u);
+}
@@ -0,0 +1,26 @@
+#ifndef RNG_H
+#define RNG_H
+
+#include <stdint.h>
+
+/**
+ * @brief Small deterministic pseudo-random generator (PCG32).
+ *
+ * Each owner keeps its own state, so independent instances never share a sequence and the same seed always
+ * reproduces the same stream regardless of what else is running.
+ */
+typedef struct {
+    uint64_t state;
+    uint64_t increment;
+} rng_t;
+
+void rng_seed(rng_t* rng, uint64_t seed);
+
+uint32_t rng_next_u32(rng_t* rng);
+
+/**
+ * @brief Get a uniformly distributed value in [0, bound) without modulo bias.
+ */
+uint32_t rng_next_bounded(rng_t* rng, uint32_t bound);
+
+#endif  // RNG_H
@@ -0,0 +1,108 @@
+#include "sparse_set.h"
+
+#include <assert.h>
+#include <stdlib.h>
+
+#include <SDL3/SDL_log.h>
+
+void sparse_set_init(sparse_set_t* set) {
+    assert(set != NULL);
+
+    set->dense = NULL;
+    set->sparse = NULL;
+    set->size = 0;
+    set->universe = 0;
+}
+
+bool sparse_set_create(sparse_set_t* set, size_t universe) {
+    assert(set != NULL);
+    assert(universe > 0);
+
+    if (universe > UINT32_MAX || universe > SIZE_MAX / sizeof(uint32_t)) {
+        SDL_Log("Sparse set allocation would overflow (universe=%zu)", universe);
+        return false;
+    }
+
+    set->dense = malloc(universe * sizeof(uint32_t));
+    set->sparse = calloc(universe, sizeof(uint32_t));
+    if (set->dense == NULL || set->sparse == NULL) {
+        SDL_Log("Failed to allocate sparse set (universe=%zu)", universe);
+        free(set->dense);
+        free(set->sparse);
+        sparse_set_init(set);
+        return false;
+    }
+
+    set->size = 0;
+    set->universe = universe;
+    return true;
+}
+
+void sparse_set_destroy(sparse_set_t* set) {
+    assert(set != NULL);
+
+    free(set->dense);
+    free(set->sparse);
+    sparse_set_init(set);
+}
+
+void sparse_set_attach(sparse_set_t* set, size_t universe, uint32_t* dense, uint32_t* sparse) {
+    assert(set != NULL);
+    assert(universe > 0 && universe <= UINT32_MAX);
+    assert(dense != NULL);
+    assert(sparse != NULL);
+
+    set->dense = dense;
+    set->sparse = sparse;
+    set->size = 0;
+    set->universe = universe;
+}
+
+bool sparse_set_contains(const sparse_set_t* set, uint32_t value) {
+    assert(set != NULL);
+    assert(value < set->universe);
+
+    // The sparse table is never cleared, so a slot only counts if the dense entry points back at the value.
+    const uint32_t slot = set->sparse[value];
+    return slot < set->size && set->dense[slot] == value;
+}
+
+void sparse_set_insert(sparse_set_t* set, uint32_t value) {
+    assert(set != NULL);
+    assert(value < set->universe);
+
+    if (sparse_set_contains(set, value) == true) {
+        return;
+    }
+
+    set->dense[set->size] = value;
+    set->sparse[value] = (uint32_t)set->size;
+    set->size++;
+}
+
+void sparse_set_remove(sparse_set_t* set, uint32_t value) {
+    assert(set != NULL);
+    assert(value < set->universe);
+
+    if (sparse_set_contains(set, value) == false) {
+        return;
+    }
+
+    const uint32_t slot = set->sparse[value];
+    const uint32_t last = set->dense[set->size - 1];
+    set->dense[slot] = last;
+    set->sparse[last] = slot;
+    set->size--;
+}
+
+uint32_t sparse_set_get(const sparse_set_t* set, size_t index) {
+    assert(set != NULL);
+    assert(index < set->size);
+
+    return set->dense[index];
+}
+
+void sparse_set_clear(sparse_set_t* set) {
+    assert(set != NULL);
+    set->size = 0;
+}
@@ -0,0 +1,55 @@
+#ifndef SPARSE_SET_H
+#define SPARSE_SET_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @brief Set of integers in [0, universe) with O(1) insert, remove, membership and uniform indexing.
+ *
+ * Members are packed into a dense array and a sparse lookup table maps each value to its slot in that array.
+ * Removing swaps the last member into the freed slot, so member order is not preserved.
+ */
+typedef struct {
+    uint32_t* dense;
+    uint32_t* sparse;
+    size_t size;
+    size_t universe;
+} sparse_set_t;
+
+void sparse_set_init(sparse_set_t* set);
+
+bool sparse_set_create(sparse_set_t* set, size_t universe);
+void sparse_set_destroy(sparse_set_t* set);
+
+/**
+ * @brief Use caller-owned arrays instead of allocating, e.g. to keep many sets in one allocation.
+ *
+ * The set starts empty. Never pass it to sparse_set_destroy(); the caller frees the arrays.
+ *
+ * @param dense Room for universe values.
+ * @param sparse Room for universe values.
+ */
+void sparse_set_attach(sparse_set_t* set, size_t universe, uint32_t* dense, uint32_t* sparse);
+
+/**
+ * @brief Add value to the set. Inserting a value that is already a member is a no-op.
+ */
+void sparse_set_insert(sparse_set_t* set, uint32_t value);
+
+/**
+ * @brief Remove value from the set. Removing a value that is not a member is a no-op.
+ */
+void sparse_set_remove(sparse_set_t* set, uint32_t value);
+
+bool sparse_set_contains(const sparse_set_t* set, uint32_t value);
+
+/**
+ * @brief Get the member stored at a dense index in [0, size).
+ */
+uint32_t sparse_set_get(const sparse_set_t* set, size_t index);
+
+void sparse_set_clear(sparse_set_t* set);
+
+#endif  // SPARSE_SET_H
@@ -0,0 +1,191 @@
+#include "thread_pool.h"
+
+#include <assert.h>
+#include <limits.h>
+#include <string.h>
+
+#include <SDL3/SDL_error.h>
+#include <SDL3/SDL_log.h>
+
+static bool run_chunk_from(thread_pool_t* pool, int queue_index) {
+    thread_pool_queue_t* const queue = &pool->queues[queue_index];
+
+    const int chunk = SDL_AddAtomicInt(&queue->next_chunk, 1);
+    if (chunk >= queue->end_chunk) {
+        return false;
+    }
+
+    const size_t begin = (size_t)chunk * pool->chunk_size;
+    size_t end = begin + pool->chunk_size;
+    if (end > pool->count) {
+        end = pool->count;
+    }
+    pool->fn(pool->user_data, begin, end);
+    return true;
+}
+
+/**
+ * @brief Drain this participant's own queue, then steal from the others until every queue is empty.
+ */
+static void run_participant(thread_pool_t* pool, int index) {
+    while (run_chunk_from(pool, index) == true) {
+    }
+
+    for (int offset = 1; offset < pool->worker_count; ++offset) {
+        const int victim = (index + offset) % pool->worker_count;
+        while (run_chunk_from(pool, victim) == true) {
+        }
+    }
+}
+
+static int worker_main(void* data) {
+    const thread_pool_worker_t* const worker = (const thread_pool_worker_t*)data;
+    thread_pool_t* const pool = worker->pool;
+    unsigned seen_generation = 0;
+
+    SDL_LockMutex(pool->mutex);
+    for (;;) {
+        while (pool->quit == false && pool->generation == seen_generation) {
+            SDL_WaitCondition(pool->work_ready, pool->mutex);
+        }
+        if (pool->quit == true) {
+            break;
+        }
+        seen_generation = pool->generation;
+        SDL_UnlockMutex(pool->mutex);
+
+        run_participant(pool, worker->index);
+
+        SDL_LockMutex(pool->mutex);
+        pool->busy_workers--;
+        if (pool->busy_workers == 0) {
+            SDL_SignalCondition(pool->work_done);
+        }
+    }
+    SDL_UnlockMutex(pool->mutex);
+
+    return 0;
+}
+
+void thread_pool_init(thread_pool_t* pool) {
+    assert(pool != NULL);
+
+    memset(pool, 0, sizeof(*pool));
+}
+
+bool thread_pool_create(thread_pool_t* pool, int worker_count) {
+    assert(pool != NULL);
+
+    if (worker_count < 1 || worker_count > THREAD_POOL_MAX_WORKERS) {
+        SDL_Log("Invalid thread pool size %d", worker_count);
+        return false;
+    }
+
+    thread_pool_init(pool);
+    pool->worker_count = worker_count;
+    pool->mutex = SDL_CreateMutex();
+    pool->work_ready = SDL_CreateCondition();
+    pool->work_done = SDL_CreateCondition();
+    if (pool->mutex == NULL || pool->work_ready == NULL || pool->work_done == NULL) {
+        SDL_Log("Failed to create thread pool locks: %s", SDL_GetError());
+        thread_pool_destroy(pool);
+        return false;
+    }
+
+    for (int i = 1; i < worker_count; ++i) {
+        pool->workers[i].pool = pool;
+        pool->workers[i].index = i;
+        pool->threads[i] = SDL_CreateThread(worker_main, "slang_worker", &pool->workers[i]);
+        if (pool->threads[i] == NULL) {
+            SDL_Log("Failed to create worker thread: %s", SDL_GetError());
+            thread_pool_destroy(pool);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+void thread_pool_destroy(thread_pool_t* pool) {
+    assert(pool != NULL);
+
+    if (pool->mutex != NULL) {
+        SDL_LockMutex(pool->mutex);
+        pool->quit = true;
+        if (pool->work_ready != NULL) {
+            SDL_BroadcastCondition(pool->work_ready);
+        }
+        SDL_UnlockMutex(pool->mutex);
+    }
+
+    for (int i = 1; i < THREAD_POOL_MAX_WORKERS; ++i) {
+        if (pool->threads[i] != NULL) {
+            SDL_WaitThread(pool->threads[i], NULL);
+        }
+    }
+
+    if (pool->work_done != NULL) {
+        SDL_DestroyCondition(pool->work_done);
+    }
+    if (pool->work_ready != NULL) {
+        SDL_DestroyCondition(pool->work_ready);
+    }
+    if (pool->mutex != NULL) {
+        SDL_DestroyMutex(pool->mutex);
+    }
+
+    thread_pool_init(pool);
+}
+
+void thread_pool_parallel_for(thread_pool_t* pool, size_t count, size_t chunk_size, thread_pool_range_fn_t fn,
+                              void* user_data) {
+    assert(pool != NULL);
+    assert(pool->worker_count > 0);
+    assert(chunk_size > 0);
+    assert(fn != NULL);
+
+    if (count == 0) {
+        return;
+    }
+
+    size_t chunk_count = (count + chunk_size - 1) / chunk_size;
+    if (chunk_count > (size_t)INT_MAX / 2) {
+        // Keep chunk indices (and the overshoot from failed steals) well inside int range.
+        chunk_size = (count + (size_t)INT_MAX / 2 - 1) / ((size_t)INT_MAX / 2);
+        chunk_count = (count + chunk_size - 1) / chunk_size;
+    }
+
+    if (pool->worker_count == 1 || chunk_count == 1) {
+        for (size_t begin = 0; begin < count; begin += chunk_size) {
+            const size_t end = begin + chunk_size < count ? begin + chunk_size : count;
+            fn(user_data, begin, end);
+        }
+        return;
+    }
+
+    pool->fn = fn;
+    pool->user_data = user_data;
+    pool->count = count;
+    pool->chunk_size = chunk_size;
+
+    // Deal contiguous runs of chunks so each participant starts on its own slice of memory.
+    const size_t participants = (size_t)pool->worker_count;
+    for (size_t i = 0; i < participants; ++i) {
+        SDL_SetAtomicInt(&pool->queues[i].next_chunk, (int)(chunk_count * i / participants));
+        pool->queues[i].end_chunk = (int)(chunk_count * (i + 1) / participants);
+    }
+
+    SDL_LockMutex(pool->mutex);
+    pool->busy_workers = pool->worker_count - 1;
+    pool->generation++;
+    SDL_BroadcastCondition(pool->work_ready);
+    SDL_UnlockMutex(pool->mutex);
+
+    run_participant(pool, 0);
+
+    SDL_LockMutex(pool->mutex);
+    while (pool->busy_workers > 0) {
+        SDL_WaitCondition(pool->work_done, pool->mutex);
+    }
+    SDL_UnlockMutex(pool->mutex);
+}
@@ -0,0 +1,80 @@
+#ifndef THREAD_POOL_H
+#define THREAD_POOL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <SDL3/SDL_atomic.h>
+#include <SDL3/SDL_mutex.h>
+#include <SDL3/SDL_thread.h>
+
+#define THREAD_POOL_MAX_WORKERS 64
+
+/**
+ * @brief Callback for one chunk of a parallel loop: handle every index in [begin, end).
+ */
+typedef void (*thread_pool_range_fn_t)(void* user_data, size_t begin, size_t end);
+
+/**
+ * @brief Chunks of a parallel loop dealt to one participant. Others steal from it once their own run out.
+ */
+typedef struct {
+    SDL_AtomicInt next_chunk;
+    int end_chunk;
+} thread_pool_queue_t;
+
+typedef struct thread_pool_t thread_pool_t;
+
+typedef struct {
+    thread_pool_t* pool;
+    int index;
+} thread_pool_worker_t;
+
+/**
+ * @brief Fixed set of worker threads for running parallel loops with work stealing.
+ *
+ * The thread calling thread_pool_parallel_for() takes part as participant 0, so a pool created with worker_count
+ * participants starts worker_count - 1 threads and a pool of one runs everything on the caller. The threads keep a
+ * pointer to the pool, so it must not move between thread_pool_create() and thread_pool_destroy().
+ */
+struct thread_pool_t {
+    SDL_Thread* threads[THREAD_POOL_MAX_WORKERS];
+    thread_pool_worker_t workers[THREAD_POOL_MAX_WORKERS];
+    int worker_count;
+
+    SDL_Mutex* mutex;
+    SDL_Condition* work_ready;
+    SDL_Condition* work_done;
+    unsigned generation;
+    int busy_workers;
+    bool quit;
+
+    /* The loop currently being run. */
+    thread_pool_range_fn_t fn;
+    void* user_data;
+    size_t count;
+    size_t chunk_size;
+    thread_pool_queue_t queues[THREAD_POOL_MAX_WORKERS];
+};
+
+void thread_pool_init(thread_pool_t* pool);
+
+/**
+ * @brief Start the worker threads.
+ *
+ * @param worker_count Participants including the calling thread, in [1, THREAD_POOL_MAX_WORKERS].
+ * @return false if the count is out of range or a thread or lock could not be created.
+ */
+bool thread_pool_create(thread_pool_t* pool, int worker_count);
+void thread_pool_destroy(thread_pool_t* pool);
+
+/**
+ * @brief Run fn over [0, count) in chunks of chunk_size spread across the pool, and wait for it to finish.
+ *
+ * Chunks are dealt out evenly up front; a participant that runs out of its own steals from the others, so uneven
+ * chunks still balance. Every index is handled exactly once, but in no particular order or thread.
+ */
+void thread_pool_parallel_for(thread_pool_t* pool, size_t count, size_t chunk_size, thread_pool_range_fn_t fn,
+                              void* user_data);
+
+#endif  // THREAD_POOL_H
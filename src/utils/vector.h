@@ -15,6 +15,4 @@ void vector2i_subtract(const vector2i_t* a, const vector2i_t* b, vector2i_t* res
 
 bool vector2i_equals(const vector2i_t* a, const vector2i_t* b);
 
-void vector2i_random(vector2i_t* vec, int max_x, int max_y);
-
 #endif  // VECTOR_H
@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <SDL3/SDL_timer.h>
+
+#include "modules/asset_loader.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(cond) TEST_ASSERT((cond) == true)
+#define TEST_ASSERT_FALSE(cond) TEST_ASSERT((cond) == false)
+
+/* What a test job does, and what it leaves behind for the test to check. */
+typedef struct {
+    /* The job waits while this is 0, so a test can keep it running. */
+    SDL_AtomicInt release;
+    bool result;
+    int value;
+} test_job_t;
+
+static bool run_test_job(void* user_data) {
+    test_job_t* const job = (test_job_t*)user_data;
+    while (SDL_GetAtomicInt(&job->release) == 0) {
+        SDL_Delay(1);
+    }
+    job->value = 42;
+    return job->result;
+}
+
+static void test_job_init(test_job_t* job, bool result, bool released) {
+    SDL_SetAtomicInt(&job->release, released == true ? 1 : 0);
+    job->result = result;
+    job->value = 0;
+}
+
+static void test_wait_returns_job_result(void) {
+    asset_loader_t loader;
+    asset_loader_init(&loader);
+
+    test_job_t good;
+    test_job_t bad;
+    test_job_init(&good, true, true);
+    test_job_init(&bad, false, true);
+    const int good_id = asset_loader_start(&loader, run_test_job, &good, "good");
+    const int bad_id = asset_loader_start(&loader, run_test_job, &bad, "bad");
+    TEST_ASSERT(good_id != -1 && bad_id != -1 && good_id != bad_id);
+
+    TEST_ASSERT_TRUE(asset_loader_wait(&loader, good_id));
+    TEST_ASSERT_EQUAL_INT(42, good.value);
+    TEST_ASSERT_FALSE(asset_loader_wait(&loader, bad_id));
+    TEST_ASSERT_TRUE(asset_loader_is_idle(&loader));
+
+    // Already collected.
+    TEST_ASSERT_FALSE(asset_loader_wait(&loader, good_id));
+
+    asset_loader_destroy(&loader);
+}
+
+static void test_poll_collects_each_finished_job_once(void) {
+    asset_loader_t loader;
+    asset_loader_init(&loader);
+
+    test_job_t jobs[3];
+    int collected[3] = {0, 0, 0};
+    for (int i = 0; i < 3; ++i) {
+        test_job_init(&jobs[i], i != 1, true);
+        TEST_ASSERT_EQUAL_INT(i, asset_loader_start(&loader, run_test_job, &jobs[i], "job"));
+    }
+
+    while (asset_loader_is_idle(&loader) == false) {
+        bool success = false;
+        const int id = asset_loader_poll(&loader, &success);
+        if (id == -1) {
+            SDL_Delay(1);
+            continue;
+        }
+        TEST_ASSERT(id >= 0 && id < 3);
+        TEST_ASSERT(success == (id != 1));
+        TEST_ASSERT_EQUAL_INT(42, jobs[id].value);
+        collected[id]++;
+    }
+
+    for (int i = 0; i < 3; ++i) {
+        TEST_ASSERT_EQUAL_INT(1, collected[i]);
+    }
+    bool success = false;
+    TEST_ASSERT_EQUAL_INT(-1, asset_loader_poll(&loader, &success));
+
+    asset_loader_destroy(&loader);
+}
+
+static void test_poll_skips_running_job(void) {
+    asset_loader_t loader;
+    asset_loader_init(&loader);
+
+    test_job_t job;
+    test_job_init(&job, true, false);
+    const int id = asset_loader_start(&loader, run_test_job, &job, "blocked");
+
+    bool success = false;
+    TEST_ASSERT_EQUAL_INT(-1, asset_loader_poll(&loader, &success));
+    TEST_ASSERT_FALSE(asset_loader_is_idle(&loader));
+
+    SDL_SetAtomicInt(&job.release, 1);
+    TEST_ASSERT_TRUE(asset_loader_wait(&loader, id));
+    TEST_ASSERT_EQUAL_INT(42, job.value);
+
+    asset_loader_destroy(&loader);
+}
+
+static void test_full_loader_rejects_job(void) {
+    asset_loader_t loader;
+    asset_loader_init(&loader);
+
+    test_job_t jobs[ASSET_LOADER_MAX_JOBS + 1];
+    for (int i = 0; i < ASSET_LOADER_MAX_JOBS; ++i) {
+        test_job_init(&jobs[i], true, true);
+        TEST_ASSERT_EQUAL_INT(i, asset_loader_start(&loader, run_test_job, &jobs[i], "job"));
+    }
+    test_job_init(&jobs[ASSET_LOADER_MAX_JOBS], true, true);
+    TEST_ASSERT_EQUAL_INT(-1, asset_loader_start(&loader, run_test_job, &jobs[ASSET_LOADER_MAX_JOBS], "extra"));
+
+    asset_loader_destroy(&loader);
+    TEST_ASSERT_EQUAL_INT(0, jobs[ASSET_LOADER_MAX_JOBS].value);
+}
+
+static void test_destroy_waits_for_running_jobs(void) {
+    asset_loader_t loader;
+    asset_loader_init(&loader);
+
+    test_job_t jobs[2];
+    for (int i = 0; i < 2; ++i) {
+        test_job_init(&jobs[i], true, true);
+        asset_loader_start(&loader, run_test_job, &jobs[i], "job");
+    }
+
+    asset_loader_destroy(&loader);
+    TEST_ASSERT_EQUAL_INT(42, jobs[0].value);
+    TEST_ASSERT_EQUAL_INT(42, jobs[1].value);
+    TEST_ASSERT_TRUE(asset_loader_is_idle(&loader));
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running asset loader unit tests...\n");
+
+    run_test("test_wait_returns_job_result", test_wait_returns_job_result);
+    run_test("test_poll_collects_each_finished_job_once", test_poll_collects_each_finished_job_once);
+    run_test("test_poll_skips_running_job", test_poll_skips_running_job);
+    run_test("test_full_loader_rejects_job", test_full_loader_rejects_job);
+    run_test("test_destroy_waits_for_running_jobs", test_destroy_waits_for_running_jobs);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d asset loader tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,165 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "modules/audio_mixer.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_FLOAT_CLOSE(expected, actual) TEST_ASSERT(fabsf((expected) - (actual)) < 0.0001f)
+
+/* Mono keeps the expected values easy to read; channel handling is covered separately. */
+static const float k_ramp[] = {0.1f, 0.2f, 0.3f, 0.4f, 0.5f, 0.6f, 0.7f, 0.8f, 0.9f};
+static const int k_ramp_frames = (int)(sizeof(k_ramp) / sizeof(k_ramp[0]));
+
+static void test_idle_mixer_outputs_silence(void) {
+    audio_mixer_t mixer;
+    audio_mixer_init(&mixer, 2);
+
+    float out[16];
+    for (int i = 0; i < 16; ++i) {
+        out[i] = 1.0f;
+    }
+    audio_mixer_mix(&mixer, out, 8);
+    for (int i = 0; i < 16; ++i) {
+        TEST_ASSERT_FLOAT_CLOSE(0.0f, out[i]);
+    }
+}
+
+static void test_voices_overlap_with_their_own_gain(void) {
+    audio_mixer_t mixer;
+    audio_mixer_init(&mixer, 1);
+
+    audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 1.0f);
+    audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 0.5f);
+    TEST_ASSERT_EQUAL_INT(2, audio_mixer_get_active_count(&mixer));
+
+    // An odd length also exercises the scalar tail after the vector loop.
+    float out[9];
+    audio_mixer_mix(&mixer, out, 9);
+    for (int i = 0; i < 9; ++i) {
+        TEST_ASSERT_FLOAT_CLOSE(k_ramp[i] * 1.5f, out[i]);
+    }
+    TEST_ASSERT_EQUAL_INT(0, audio_mixer_get_active_count(&mixer));
+}
+
+static void test_voice_continues_across_buffers_and_ends(void) {
+    audio_mixer_t mixer;
+    audio_mixer_init(&mixer, 1);
+    audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 1.0f);
+
+    float out[6];
+    audio_mixer_mix(&mixer, out, 6);
+    TEST_ASSERT_FLOAT_CLOSE(0.6f, out[5]);
+    TEST_ASSERT_EQUAL_INT(1, audio_mixer_get_active_count(&mixer));
+
+    // Three frames left, then silence for the rest of the buffer.
+    audio_mixer_mix(&mixer, out, 6);
+    TEST_ASSERT_FLOAT_CLOSE(0.7f, out[0]);
+    TEST_ASSERT_FLOAT_CLOSE(0.9f, out[2]);
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, out[3]);
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, out[5]);
+    TEST_ASSERT_EQUAL_INT(0, audio_mixer_get_active_count(&mixer));
+}
+
+static void test_full_pool_steals_oldest_voice(void) {
+    audio_mixer_t mixer;
+    audio_mixer_init(&mixer, 1);
+
+    int first = -1;
+    for (int i = 0; i < AUDIO_MIXER_VOICE_COUNT; ++i) {
+        const int voice = audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 1.0f);
+        if (i == 0) {
+            first = voice;
+        }
+    }
+    TEST_ASSERT_EQUAL_INT(AUDIO_MIXER_VOICE_COUNT, audio_mixer_get_active_count(&mixer));
+
+    float out[2];
+    audio_mixer_mix(&mixer, out, 2);
+
+    // The oldest voice restarts from the top with the new sound; the rest keep playing.
+    TEST_ASSERT_EQUAL_INT(first, audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 0.0f));
+    TEST_ASSERT_EQUAL_INT(AUDIO_MIXER_VOICE_COUNT, audio_mixer_get_active_count(&mixer));
+    audio_mixer_mix(&mixer, out, 1);
+    TEST_ASSERT_FLOAT_CLOSE(k_ramp[2] * (float)(AUDIO_MIXER_VOICE_COUNT - 1), out[0]);
+
+    // The next steal takes the oldest of the original voices, not the one just restarted.
+    TEST_ASSERT(audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 1.0f) != first);
+}
+
+static void test_stereo_frames_are_interleaved(void) {
+    static const float stereo[] = {0.1f, -0.1f, 0.2f, -0.2f, 0.3f, -0.3f};
+    audio_mixer_t mixer;
+    audio_mixer_init(&mixer, 2);
+    audio_mixer_play(&mixer, stereo, 3, 2.0f);
+
+    float out[4];
+    audio_mixer_mix(&mixer, out, 2);
+    TEST_ASSERT_FLOAT_CLOSE(0.2f, out[0]);
+    TEST_ASSERT_FLOAT_CLOSE(-0.2f, out[1]);
+    TEST_ASSERT_FLOAT_CLOSE(0.4f, out[2]);
+    TEST_ASSERT_FLOAT_CLOSE(-0.4f, out[3]);
+
+    audio_mixer_mix(&mixer, out, 2);
+    TEST_ASSERT_FLOAT_CLOSE(0.6f, out[0]);
+    TEST_ASSERT_FLOAT_CLOSE(-0.6f, out[1]);
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, out[2]);
+}
+
+static void test_stop_all_silences_every_voice(void) {
+    audio_mixer_t mixer;
+    audio_mixer_init(&mixer, 1);
+    audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 1.0f);
+    audio_mixer_play(&mixer, k_ramp, k_ramp_frames, 1.0f);
+
+    audio_mixer_stop_all(&mixer);
+    TEST_ASSERT_EQUAL_INT(0, audio_mixer_get_active_count(&mixer));
+
+    float out[4];
+    audio_mixer_mix(&mixer, out, 4);
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, out[0]);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running audio mixer unit tests...\n");
+
+    run_test("test_idle_mixer_outputs_silence", test_idle_mixer_outputs_silence);
+    run_test("test_voices_overlap_with_their_own_gain", test_voices_overlap_with_their_own_gain);
+    run_test("test_voice_continues_across_buffers_and_ends", test_voice_continues_across_buffers_and_ends);
+    run_test("test_full_pool_steals_oldest_voice", test_full_pool_steals_oldest_voice);
+    run_test("test_stereo_frames_are_interleaved", test_stereo_frames_are_interleaved);
+    run_test("test_stop_all_silences_every_voice", test_stop_all_silences_every_voice);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d audio mixer tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -34,10 +34,21 @@ static void test_defaults(void) {
     TEST_ASSERT_EQUAL_BOOL(false, config.mute);
     TEST_ASSERT_FLOAT_CLOSE(1.0f, config.volume);
     TEST_ASSERT_EQUAL_INT(CONFIG_RESUME_DELAY_DEFAULT, config.resume_delay_seconds);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GRID_SIZE_DEFAULT, config.grid_width);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GRID_SIZE_DEFAULT, config.grid_height);
+    TEST_ASSERT_EQUAL_BOOL(false, config.fullscreen);
+    TEST_ASSERT_EQUAL_BOOL(true, config.vsync);
+    TEST_ASSERT_EQUAL_INT(CONFIG_FPS_CAP_DEFAULT, config.fps_cap);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_RATE_DEFAULT, config.tick_rate);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_RATE_DEFAULT, config.tick_rate_max);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_CURVE_CONSTANT, config.speed_curve);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_STEP_DEFAULT, config.speed_step);
 }
 
 static void test_parse_valid_buffer(void) {
-    const char* contents = "high_score=12\nmute=yes\nvolume=0.375\nresume_delay=3\n";
+    const char* contents =
+        "high_score=12\nmute=yes\nvolume=0.375\nresume_delay=3\ngrid_width=128\ngrid_height=64\nfullscreen=true\n"
+        "vsync=no\nfps_cap=144\ntick_rate=10\ntick_rate_max=30\nspeed_curve=Linear\nspeed_step=4\n";
     game_config_t config = {0};
     bool invalid = false;
 
@@ -47,6 +58,15 @@ static void test_parse_valid_buffer(void) {
     TEST_ASSERT_EQUAL_BOOL(true, config.mute);
     TEST_ASSERT_FLOAT_CLOSE(0.375f, config.volume);
     TEST_ASSERT_EQUAL_INT(3, config.resume_delay_seconds);
+    TEST_ASSERT_EQUAL_INT(128, config.grid_width);
+    TEST_ASSERT_EQUAL_INT(64, config.grid_height);
+    TEST_ASSERT_EQUAL_BOOL(true, config.fullscreen);
+    TEST_ASSERT_EQUAL_BOOL(false, config.vsync);
+    TEST_ASSERT_EQUAL_INT(144, config.fps_cap);
+    TEST_ASSERT_EQUAL_INT(10, config.tick_rate);
+    TEST_ASSERT_EQUAL_INT(30, config.tick_rate_max);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_CURVE_LINEAR, config.speed_curve);
+    TEST_ASSERT_EQUAL_INT(4, config.speed_step);
 }
 
 static void test_parse_invalid_line_marks_config_invalid(void) {
@@ -67,6 +87,15 @@ static void test_parse_invalid_value_marks_config_invalid(void) {
     TEST_ASSERT_EQUAL_BOOL(true, invalid);
 }
 
+static void test_parse_unknown_speed_curve_marks_config_invalid(void) {
+    const char* contents = "speed_curve=exponential\n";
+    game_config_t config = {0};
+    bool invalid = false;
+
+    TEST_ASSERT(config_parse_buffer(contents, &config, &invalid) == false);
+    TEST_ASSERT_EQUAL_BOOL(true, invalid);
+}
+
 static void test_parse_whitespace_around_equals(void) {
     const char* contents = "high_score = 7\nmute = no\nvolume = 0.5\nresume_delay = 1\n";
     game_config_t config = {0};
@@ -86,12 +115,40 @@ static void test_normalize_clamps_values(void) {
         .mute = false,
         .volume = 2.5f,
         .resume_delay_seconds = -7,
+        .grid_width = 2,
+        .grid_height = 100000,
+        .fps_cap = 5,
+        .tick_rate = 0,
+        .tick_rate_max = 100000,
+        .speed_curve = (snake_speed_curve_t)42,
+        .speed_step = 0,
     };
 
     config_normalize(&config);
 
     TEST_ASSERT_FLOAT_CLOSE(1.0f, config.volume);
     TEST_ASSERT_EQUAL_INT(CONFIG_RESUME_DELAY_MIN, config.resume_delay_seconds);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GRID_SIZE_MIN, config.grid_width);
+    TEST_ASSERT_EQUAL_INT(CONFIG_GRID_SIZE_MAX, config.grid_height);
+    TEST_ASSERT_EQUAL_INT(CONFIG_FPS_CAP_MIN, config.fps_cap);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_RATE_MIN, config.tick_rate);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_RATE_MAX, config.tick_rate_max);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_CURVE_CONSTANT, config.speed_curve);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_STEP_MIN, config.speed_step);
+
+    config.fps_cap = 0;
+    config_normalize(&config);
+    TEST_ASSERT_EQUAL_INT(0, config.fps_cap);
+
+    config.fps_cap = 100000;
+    config_normalize(&config);
+    TEST_ASSERT_EQUAL_INT(CONFIG_FPS_CAP_MAX, config.fps_cap);
+
+    /* The curve never tops out below where it starts. */
+    config.tick_rate = 20;
+    config.tick_rate_max = 12;
+    config_normalize(&config);
+    TEST_ASSERT_EQUAL_INT(20, config.tick_rate_max);
 }
 
 static void test_serialize_normalizes_and_round_trips(void) {
@@ -100,8 +157,17 @@ static void test_serialize_normalizes_and_round_trips(void) {
         .mute = true,
         .volume = -1.0f,
         .resume_delay_seconds = 99,
+        .grid_width = 4096,
+        .grid_height = 24,
+        .fullscreen = true,
+        .vsync = false,
+        .fps_cap = 2000,
+        .tick_rate = 12,
+        .tick_rate_max = 400,
+        .speed_curve = SNAKE_SPEED_CURVE_STEPPED,
+        .speed_step = 3,
     };
-    char buffer[128];
+    char buffer[512];
     game_config_t reparsed = {0};
     bool invalid = false;
 
@@ -112,6 +178,15 @@ static void test_serialize_normalizes_and_round_trips(void) {
     TEST_ASSERT_EQUAL_BOOL(true, reparsed.mute);
     TEST_ASSERT_FLOAT_CLOSE(0.0f, reparsed.volume);
     TEST_ASSERT_EQUAL_INT(CONFIG_RESUME_DELAY_MAX, reparsed.resume_delay_seconds);
+    TEST_ASSERT_EQUAL_INT(4096, reparsed.grid_width);
+    TEST_ASSERT_EQUAL_INT(24, reparsed.grid_height);
+    TEST_ASSERT_EQUAL_BOOL(true, reparsed.fullscreen);
+    TEST_ASSERT_EQUAL_BOOL(false, reparsed.vsync);
+    TEST_ASSERT_EQUAL_INT(CONFIG_FPS_CAP_MAX, reparsed.fps_cap);
+    TEST_ASSERT_EQUAL_INT(12, reparsed.tick_rate);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_RATE_MAX, reparsed.tick_rate_max);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_CURVE_STEPPED, reparsed.speed_curve);
+    TEST_ASSERT_EQUAL_INT(3, reparsed.speed_step);
 }
 
 static void run_test(const char* name, test_fn_t fn) {
@@ -131,6 +206,8 @@ int main(void) {
     run_test("test_parse_valid_buffer", test_parse_valid_buffer);
     run_test("test_parse_invalid_line_marks_config_invalid", test_parse_invalid_line_marks_config_invalid);
     run_test("test_parse_invalid_value_marks_config_invalid", test_parse_invalid_value_marks_config_invalid);
+    run_test("test_parse_unknown_speed_curve_marks_config_invalid",
+             test_parse_unknown_speed_curve_marks_config_invalid);
     run_test("test_parse_whitespace_around_equals", test_parse_whitespace_around_equals);
     run_test("test_normalize_clamps_values", test_normalize_clamps_values);
     run_test("test_serialize_normalizes_and_round_trips", test_serialize_normalizes_and_round_trips);
@@ -0,0 +1,106 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "modules/frame_pacer.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_U64(expected, actual) TEST_ASSERT((Uint64)(expected) == (Uint64)(actual))
+
+/* 100 FPS keeps the interval a round number of nanoseconds. */
+static const Uint64 k_interval = SDL_NS_PER_SECOND / 100;
+
+static void test_uncapped_never_sleeps(void) {
+    frame_pacer_t pacer;
+    frame_pacer_init(&pacer, 0);
+
+    TEST_ASSERT_EQUAL_U64(0, pacer.frame_interval);
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 1000));
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 1001));
+}
+
+static void test_sleeps_the_rest_of_the_interval(void) {
+    frame_pacer_t pacer;
+    frame_pacer_init(&pacer, 100);
+
+    TEST_ASSERT_EQUAL_U64(k_interval, pacer.frame_interval);
+
+    // The first frame sets the cadence; the next one is due a whole interval later.
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 1000));
+    TEST_ASSERT_EQUAL_U64(k_interval - 3000, frame_pacer_schedule(&pacer, 4000));
+    // Time spent rendering counts towards the interval, so the cadence does not drift.
+    TEST_ASSERT_EQUAL_U64(k_interval - 500, frame_pacer_schedule(&pacer, 1000 + k_interval + 500));
+}
+
+static void test_slightly_late_frame_keeps_the_cadence(void) {
+    frame_pacer_t pacer;
+    frame_pacer_init(&pacer, 100);
+
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 0));
+    // Half an interval late: no sleep, and the following frame is still due on the original grid.
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, k_interval + k_interval / 2));
+    TEST_ASSERT_EQUAL_U64(k_interval / 2, frame_pacer_schedule(&pacer, k_interval + k_interval / 2));
+}
+
+static void test_stall_restarts_the_cadence(void) {
+    frame_pacer_t pacer;
+    frame_pacer_init(&pacer, 100);
+
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 0));
+    // Far behind: no burst of catch-up frames, the next one is a full interval after the stall.
+    const Uint64 stall_end = 10 * k_interval + 7;
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, stall_end));
+    TEST_ASSERT_EQUAL_U64(k_interval, frame_pacer_schedule(&pacer, stall_end));
+}
+
+static void test_changing_cap_restarts_the_cadence(void) {
+    frame_pacer_t pacer;
+    frame_pacer_init(&pacer, 100);
+
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 0));
+    frame_pacer_set_fps_cap(&pacer, 50);
+    TEST_ASSERT_EQUAL_U64(2 * k_interval, pacer.frame_interval);
+    TEST_ASSERT_EQUAL_U64(0, frame_pacer_schedule(&pacer, 100));
+    TEST_ASSERT_EQUAL_U64(2 * k_interval, frame_pacer_schedule(&pacer, 100));
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running frame pacer unit tests...\n");
+
+    run_test("test_uncapped_never_sleeps", test_uncapped_never_sleeps);
+    run_test("test_sleeps_the_rest_of_the_interval", test_sleeps_the_rest_of_the_interval);
+    run_test("test_slightly_late_frame_keeps_the_cadence", test_slightly_late_frame_keeps_the_cadence);
+    run_test("test_stall_restarts_the_cadence", test_stall_restarts_the_cadence);
+    run_test("test_changing_cap_restarts_the_cadence", test_changing_cap_restarts_the_cadence);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d frame pacer tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
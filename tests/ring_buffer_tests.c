@@ -0,0 +1,182 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "utils/ring_buffer.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_SIZE_T(expected, actual) TEST_ASSERT((size_t)(expected) == (size_t)(actual))
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_NOT_NULL(ptr) TEST_ASSERT((ptr) != NULL)
+#define TEST_ASSERT_NULL(ptr) TEST_ASSERT((ptr) == NULL)
+
+static void test_create_and_destroy(void) {
+    ring_buffer_t buffer;
+    ring_buffer_init(&buffer);
+
+    TEST_ASSERT_NULL(buffer.data);
+    TEST_ASSERT_EQUAL_SIZE_T(0, buffer.size);
+    TEST_ASSERT_EQUAL_SIZE_T(0, buffer.capacity);
+
+    TEST_ASSERT(ring_buffer_create(&buffer, sizeof(int), 4));
+
+    TEST_ASSERT_NOT_NULL(buffer.data);
+    TEST_ASSERT_EQUAL_SIZE_T(0, buffer.size);
+    TEST_ASSERT_EQUAL_SIZE_T(4, buffer.capacity);
+
+    ring_buffer_destroy(&buffer);
+
+    TEST_ASSERT_NULL(buffer.data);
+    TEST_ASSERT_EQUAL_SIZE_T(0, buffer.size);
+    TEST_ASSERT_EQUAL_SIZE_T(0, buffer.capacity);
+}
+
+static void test_push_front_orders_newest_first(void) {
+    ring_buffer_t buffer;
+    ring_buffer_init(&buffer);
+    TEST_ASSERT(ring_buffer_create(&buffer, sizeof(int), 4));
+
+    for (int i = 0; i < 3; ++i) {
+        TEST_ASSERT(ring_buffer_push_front(&buffer, &i));
+    }
+
+    TEST_ASSERT_EQUAL_SIZE_T(3, buffer.size);
+    TEST_ASSERT_EQUAL_INT(2, *(int*)ring_buffer_front(&buffer));
+    TEST_ASSERT_EQUAL_INT(0, *(int*)ring_buffer_back(&buffer));
+    TEST_ASSERT_EQUAL_INT(1, *(int*)ring_buffer_get(&buffer, 1));
+
+    ring_buffer_destroy(&buffer);
+}
+
+static void test_slide_keeps_order_across_wrap(void) {
+    ring_buffer_t buffer;
+    ring_buffer_init(&buffer);
+    TEST_ASSERT(ring_buffer_create(&buffer, sizeof(int), 4));
+
+    for (int i = 0; i < 4; ++i) {
+        TEST_ASSERT(ring_buffer_push_front(&buffer, &i));
+    }
+
+    /* Pop the back and push a new front many times so the window wraps repeatedly. */
+    for (int i = 4; i < 23; ++i) {
+        int popped = -1;
+        ring_buffer_pop_back(&buffer, &popped);
+        TEST_ASSERT_EQUAL_INT(i - 4, popped);
+        TEST_ASSERT(ring_buffer_push_front(&buffer, &i));
+        TEST_ASSERT_EQUAL_SIZE_T(4, buffer.capacity);
+    }
+
+    for (size_t i = 0; i < buffer.size; ++i) {
+        TEST_ASSERT_EQUAL_INT(22 - (int)i, *(int*)ring_buffer_get(&buffer, i));
+    }
+
+    ring_buffer_destroy(&buffer);
+}
+
+static void test_growth_unwraps_elements(void) {
+    ring_buffer_t buffer;
+    ring_buffer_init(&buffer);
+    TEST_ASSERT(ring_buffer_create(&buffer, sizeof(int), 4));
+
+    /* Leave the front in the middle of the allocation so the contents wrap. */
+    for (int i = 0; i < 3; ++i) {
+        TEST_ASSERT(ring_buffer_push_front(&buffer, &i));
+    }
+    ring_buffer_pop_back(&buffer, NULL);
+    ring_buffer_pop_back(&buffer, NULL);
+    for (int i = 3; i < 10; ++i) {
+        TEST_ASSERT(ring_buffer_push_front(&buffer, &i));
+    }
+
+    TEST_ASSERT_EQUAL_SIZE_T(8, buffer.size);
+    TEST_ASSERT_EQUAL_SIZE_T(8, buffer.capacity);
+    for (size_t i = 0; i < 7; ++i) {
+        TEST_ASSERT_EQUAL_INT(9 - (int)i, *(int*)ring_buffer_get(&buffer, i));
+    }
+    TEST_ASSERT_EQUAL_INT(2, *(int*)ring_buffer_back(&buffer));
+
+    int value = 100;
+    TEST_ASSERT(ring_buffer_push_back(&buffer, &value));
+    TEST_ASSERT_EQUAL_SIZE_T(16, buffer.capacity);
+    TEST_ASSERT_EQUAL_INT(9, *(int*)ring_buffer_front(&buffer));
+    TEST_ASSERT_EQUAL_INT(2, *(int*)ring_buffer_get(&buffer, 7));
+    TEST_ASSERT_EQUAL_INT(100, *(int*)ring_buffer_back(&buffer));
+
+    ring_buffer_destroy(&buffer);
+}
+
+static void test_is_empty_and_clear(void) {
+    ring_buffer_t buffer;
+    ring_buffer_init(&buffer);
+    TEST_ASSERT(ring_buffer_is_empty(&buffer));
+
+    TEST_ASSERT(ring_buffer_create(&buffer, sizeof(int), 2));
+    TEST_ASSERT(ring_buffer_is_empty(&buffer));
+
+    int value = 42;
+    TEST_ASSERT(ring_buffer_push_front(&buffer, &value));
+    TEST_ASSERT(ring_buffer_push_front(&buffer, &value));
+    TEST_ASSERT(!ring_buffer_is_empty(&buffer));
+    const size_t cap_before = buffer.capacity;
+
+    ring_buffer_clear(&buffer);
+
+    TEST_ASSERT(ring_buffer_is_empty(&buffer));
+    TEST_ASSERT_EQUAL_SIZE_T(cap_before, buffer.capacity);
+    TEST_ASSERT(buffer.data != NULL);
+
+    ring_buffer_destroy(&buffer);
+}
+
+static void test_create_rejects_overflow(void) {
+    ring_buffer_t buffer;
+    ring_buffer_init(&buffer);
+
+    TEST_ASSERT(ring_buffer_create(&buffer, sizeof(int), SIZE_MAX) == false);
+    TEST_ASSERT_NULL(buffer.data);
+    TEST_ASSERT_EQUAL_SIZE_T(0, buffer.capacity);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running ring buffer unit tests...\n");
+
+    run_test("test_create_and_destroy", test_create_and_destroy);
+    run_test("test_push_front_orders_newest_first", test_push_front_orders_newest_first);
+    run_test("test_slide_keeps_order_across_wrap", test_slide_keeps_order_across_wrap);
+    run_test("test_growth_unwraps_elements", test_growth_unwraps_elements);
+    run_test("test_is_empty_and_clear", test_is_empty_and_clear);
+    run_test("test_create_rejects_overflow", test_create_rejects_overflow);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d ring buffer tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,113 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+
+#include "utils/rng.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+
+static void test_same_seed_same_sequence(void) {
+    rng_t a;
+    rng_t b;
+    rng_seed(&a, 42u);
+    rng_seed(&b, 42u);
+
+    for (int i = 0; i < 1000; ++i) {
+        TEST_ASSERT(rng_next_u32(&a) == rng_next_u32(&b));
+    }
+}
+
+static void test_different_seeds_diverge(void) {
+    rng_t a;
+    rng_t b;
+    rng_seed(&a, 1u);
+    rng_seed(&b, 2u);
+
+    int matches = 0;
+    for (int i = 0; i < 100; ++i) {
+        if (rng_next_u32(&a) == rng_next_u32(&b)) {
+            ++matches;
+        }
+    }
+
+    TEST_ASSERT(matches < 5);
+}
+
+static void test_reseed_restarts_sequence(void) {
+    rng_t rng;
+    rng_seed(&rng, 7u);
+    const uint32_t first = rng_next_u32(&rng);
+    (void)rng_next_u32(&rng);
+
+    rng_seed(&rng, 7u);
+    TEST_ASSERT(rng_next_u32(&rng) == first);
+}
+
+static void test_bounded_stays_in_range_and_covers_it(void) {
+    rng_t rng;
+    rng_seed(&rng, 2024u);
+
+    int counts[7] = {0};
+    for (int i = 0; i < 7000; ++i) {
+        const uint32_t value = rng_next_bounded(&rng, 7);
+        TEST_ASSERT(value < 7);
+        ++counts[value];
+    }
+
+    /* Each bucket expects 1000 hits; allow a wide margin so the test is not flaky. */
+    for (int i = 0; i < 7; ++i) {
+        TEST_ASSERT(counts[i] > 850 && counts[i] < 1150);
+    }
+}
+
+static void test_bounded_one_is_always_zero(void) {
+    rng_t rng;
+    rng_seed(&rng, 5u);
+
+    for (int i = 0; i < 50; ++i) {
+        TEST_ASSERT_EQUAL_INT(0, rng_next_bounded(&rng, 1));
+    }
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running rng unit tests...\n");
+
+    run_test("test_same_seed_same_sequence", test_same_seed_same_sequence);
+    run_test("test_different_seeds_diverge", test_different_seeds_diverge);
+    run_test("test_reseed_restarts_sequence", test_reseed_restarts_sequence);
+    run_test("test_bounded_stays_in_range_and_covers_it", test_bounded_stays_in_range_and_covers_it);
+    run_test("test_bounded_one_is_always_zero", test_bounded_one_is_always_zero);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d rng tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,408 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/snake_batch.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_SIZE_T(expected, actual) TEST_ASSERT((size_t)(expected) == (size_t)(actual))
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(value) TEST_ASSERT((value) == true)
+#define TEST_ASSERT_FALSE(value) TEST_ASSERT((value) == false)
+
+static const int k_grid_size = 20;
+
+static int count_states(const snake_batch_t* batch, size_t index, snake_cell_state_t state) {
+    const uint8_t* const states = snake_batch_get_observation(batch, index);
+    int count = 0;
+    for (size_t cell = 0; cell < batch->cells_per_instance; ++cell) {
+        if (states[cell] == state) {
+            ++count;
+        }
+    }
+    return count;
+}
+
+static uint32_t cell_at(const snake_batch_t* batch, int x, int y) {
+    return (uint32_t)(y * batch->grid_width + x);
+}
+
+/* Steer one axis at a time towards the first food cell in memory order. */
+static uint8_t direction_towards_food(const snake_batch_t* batch, size_t index) {
+    const uint8_t* const states = snake_batch_get_observation(batch, index);
+    const int head_x = (int)(batch->heads[index] % (uint32_t)batch->grid_width);
+    const int head_y = (int)(batch->heads[index] / (uint32_t)batch->grid_width);
+
+    for (size_t cell = 0; cell < batch->cells_per_instance; ++cell) {
+        if (states[cell] != SNAKE_CELL_FOOD) {
+            continue;
+        }
+        const int x = (int)(cell % (size_t)batch->grid_width);
+        const int y = (int)(cell / (size_t)batch->grid_width);
+        if (x != head_x) {
+            return x < head_x ? SNAKE_DIRECTION_LEFT : SNAKE_DIRECTION_RIGHT;
+        }
+        return y < head_y ? SNAKE_DIRECTION_UP : SNAKE_DIRECTION_DOWN;
+    }
+    return SNAKE_BATCH_ACTION_KEEP;
+}
+
+/* Replace instance 0 with a food-free board holding a snake laid out as head followed by body segments. */
+static void place_snake(snake_batch_t* batch, vector2i_t head, const vector2i_t* body, size_t body_count,
+                        snake_direction_t direction) {
+    uint8_t* const states = batch->cell_states;
+    uint8_t* const links = batch->cell_links;
+    memset(states, SNAKE_CELL_EMPTY, batch->cells_per_instance);
+
+    vector2i_t ahead = head;
+    states[cell_at(batch, head.x, head.y)] = SNAKE_CELL_SNAKE;
+    for (size_t i = 0; i < body_count; ++i) {
+        const uint32_t cell = cell_at(batch, body[i].x, body[i].y);
+        states[cell] = SNAKE_CELL_SNAKE;
+        if (ahead.x != body[i].x) {
+            links[cell] = ahead.x < body[i].x ? SNAKE_DIRECTION_LEFT : SNAKE_DIRECTION_RIGHT;
+        } else {
+            links[cell] = ahead.y < body[i].y ? SNAKE_DIRECTION_UP : SNAKE_DIRECTION_DOWN;
+        }
+        ahead = body[i];
+    }
+
+    batch->heads[0] = cell_at(batch, head.x, head.y);
+    batch->tails[0] = cell_at(batch, ahead.x, ahead.y);
+    batch->lengths[0] = (uint32_t)body_count + 1;
+    batch->directions[0] = (uint8_t)direction;
+
+    const snake_rules_grid_t grid = {states, &batch->free_cells[0], &batch->rngs[0], batch->grid_width,
+                                     batch->grid_height};
+    snake_rules_sync_free_cells(&grid);
+}
+
+static void test_create_starts_every_instance(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+    TEST_ASSERT_TRUE(snake_batch_create(&batch, 16, k_grid_size, k_grid_size, 1u));
+
+    TEST_ASSERT_EQUAL_SIZE_T(16, batch.count);
+    TEST_ASSERT_EQUAL_SIZE_T(k_grid_size * k_grid_size, batch.cells_per_instance);
+    for (size_t i = 0; i < batch.count; ++i) {
+        TEST_ASSERT_EQUAL_INT(1, count_states(&batch, i, SNAKE_CELL_SNAKE));
+        TEST_ASSERT_EQUAL_INT(SNAKE_SIM_FOOD_COUNT, count_states(&batch, i, SNAKE_CELL_FOOD));
+        TEST_ASSERT_EQUAL_SIZE_T(0, snake_batch_get_score(&batch, i));
+        TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_UP, batch.directions[i]);
+    }
+
+    snake_batch_destroy(&batch);
+    TEST_ASSERT(batch.cell_states == NULL);
+    TEST_ASSERT_EQUAL_SIZE_T(0, batch.count);
+}
+
+static void test_create_rejects_invalid_sizes(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+
+    TEST_ASSERT_FALSE(snake_batch_create(&batch, 0, k_grid_size, k_grid_size, 1u));
+    TEST_ASSERT_FALSE(snake_batch_create(&batch, 4, SNAKE_SIM_GRID_MIN - 1, k_grid_size, 1u));
+    TEST_ASSERT_FALSE(snake_batch_create(&batch, 4, k_grid_size, SNAKE_SIM_GRID_MAX + 1, 1u));
+    TEST_ASSERT(batch.cell_states == NULL);
+}
+
+static void test_eating_food_rewards_and_grows(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+    TEST_ASSERT_TRUE(snake_batch_create(&batch, 1, k_grid_size, k_grid_size, 9u));
+
+    float reward = 0.0f;
+    uint8_t done = 0;
+    int ticks = 0;
+    while (reward != SNAKE_BATCH_REWARD_FOOD && ticks < k_grid_size * k_grid_size) {
+        const uint8_t action = direction_towards_food(&batch, 0);
+        snake_batch_step(&batch, &action, &reward, &done);
+        TEST_ASSERT_EQUAL_INT(0, done);
+        ++ticks;
+    }
+
+    TEST_ASSERT(reward == SNAKE_BATCH_REWARD_FOOD);
+    TEST_ASSERT_EQUAL_SIZE_T(1, snake_batch_get_score(&batch, 0));
+    TEST_ASSERT_EQUAL_INT(2, count_states(&batch, 0, SNAKE_CELL_SNAKE));
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_FOOD_COUNT, count_states(&batch, 0, SNAKE_CELL_FOOD));
+
+    snake_batch_destroy(&batch);
+}
+
+static void test_keep_action_wraps_around(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+    TEST_ASSERT_TRUE(snake_batch_create(&batch, 1, k_grid_size, k_grid_size, 3u));
+
+    place_snake(&batch, (vector2i_t){5, 1}, NULL, 0, SNAKE_DIRECTION_UP);
+
+    snake_batch_step(&batch, NULL, NULL, NULL);
+    TEST_ASSERT_EQUAL_INT(cell_at(&batch, 5, k_grid_size - 2), batch.heads[0]);
+    TEST_ASSERT_EQUAL_INT(1, count_states(&batch, 0, SNAKE_CELL_SNAKE));
+
+    /* A reversal is ignored, the snake keeps going up. */
+    const uint8_t reverse = SNAKE_DIRECTION_DOWN;
+    snake_batch_step(&batch, &reverse, NULL, NULL);
+    TEST_ASSERT_EQUAL_INT(cell_at(&batch, 5, k_grid_size - 3), batch.heads[0]);
+
+    snake_batch_destroy(&batch);
+}
+
+static void test_moving_into_vacated_tail_is_not_a_collision(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+    TEST_ASSERT_TRUE(snake_batch_create(&batch, 1, k_grid_size, k_grid_size, 5u));
+
+    const vector2i_t body[] = {{11, 10}, {11, 11}, {10, 11}};
+    place_snake(&batch, (vector2i_t){10, 10}, body, 3, SNAKE_DIRECTION_DOWN);
+
+    float reward = 1.0f;
+    uint8_t done = 1;
+    snake_batch_step(&batch, NULL, &reward, &done);
+    TEST_ASSERT_EQUAL_INT(0, done);
+    TEST_ASSERT(reward == 0.0f);
+    TEST_ASSERT_EQUAL_INT(cell_at(&batch, 10, 11), batch.heads[0]);
+    TEST_ASSERT_EQUAL_INT(cell_at(&batch, 11, 11), batch.tails[0]);
+    TEST_ASSERT_EQUAL_INT(4, count_states(&batch, 0, SNAKE_CELL_SNAKE));
+
+    snake_batch_destroy(&batch);
+}
+
+static void test_moving_into_body_ends_round_and_resets(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+    TEST_ASSERT_TRUE(snake_batch_create(&batch, 1, k_grid_size, k_grid_size, 6u));
+
+    const vector2i_t body[] = {{11, 10}, {11, 11}, {10, 11}, {10, 12}};
+    place_snake(&batch, (vector2i_t){10, 10}, body, 4, SNAKE_DIRECTION_DOWN);
+
+    float reward = 0.0f;
+    uint8_t done = 0;
+    snake_batch_step(&batch, NULL, &reward, &done);
+    TEST_ASSERT_EQUAL_INT(1, done);
+    TEST_ASSERT(reward == SNAKE_BATCH_REWARD_DEATH);
+
+    /* The observation already shows the next round. */
+    TEST_ASSERT_EQUAL_SIZE_T(0, snake_batch_get_score(&batch, 0));
+    TEST_ASSERT_EQUAL_INT(1, count_states(&batch, 0, SNAKE_CELL_SNAKE));
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_FOOD_COUNT, count_states(&batch, 0, SNAKE_CELL_FOOD));
+
+    snake_batch_destroy(&batch);
+}
+
+static void test_grid_matches_bookkeeping_over_long_run(void) {
+    snake_batch_t batch;
+    snake_batch_init(&batch);
+    TEST_ASSERT_TRUE(snake_batch_create(&batch, 8, SNAKE_SIM_GRID_MIN, SNAKE_SIM_GRID_MIN + 8, 2024u));
+
+    const int interior = (batch.grid_width - 2) * (batch.grid_height - 2);
+    uint8_t actions[8];
+    size_t best_score = 0;
+    int deaths = 0;
+
+    for (int tick = 0; tick < 3000; ++tick) {
+        for (size_t i = 0; i < batch.count; ++i) {
+            /* Half the instances chase food, the rest wander so they also die now and then. */
+            actions[i] = (i % 2 == 0) ? direction_towards_food(&batch, i) : (uint8_t)((tick / 7 + (int)i) % 4);
+        }
+
+        uint8_t dones[8];
+        snake_batch_step(&batch, actions, NULL, dones);
+
+        for (size_t i = 0; i < batch.count; ++i) {
+            deaths += dones[i];
+            const size_t score = snake_batch_get_score(&batch, i);
+            best_score = score > best_score ? score : best_score;
+
+            TEST_ASSERT_EQUAL_INT((int)score + 1, count_states(&batch, i, SNAKE_CELL_SNAKE));
+            TEST_ASSERT_EQUAL_INT(interior - (int)score - 1 - count_states(&batch, i, SNAKE_CELL_FOOD),
+                                  (int)batch.free_cells[i].size);
+
+            /* Following the links from the tail must land on the head after length - 1 steps. */
+            uint32_t cell = batch.tails[i];
+            for (size_t segment = 0; segment < score; ++segment) {
+                TEST_ASSERT_EQUAL_INT(SNAKE_CELL_SNAKE, snake_batch_get_observation(&batch, i)[cell]);
+                const uint8_t link = batch.cell_links[i * batch.cells_per_instance + cell];
+                const int x = (int)(cell % (uint32_t)batch.grid_width);
+                const int y = (int)(cell / (uint32_t)batch.grid_width);
+                int next_x = x;
+                int next_y = y;
+                if (link == SNAKE_DIRECTION_UP) {
+                    next_y = y == 1 ? batch.grid_height - 2 : y - 1;
+                } else if (link == SNAKE_DIRECTION_DOWN) {
+                    next_y = y == batch.grid_height - 2 ? 1 : y + 1;
+                } else if (link == SNAKE_DIRECTION_LEFT) {
+                    next_x = x == 1 ? batch.grid_width - 2 : x - 1;
+                } else {
+                    next_x = x == batch.grid_width - 2 ? 1 : x + 1;
+                }
+                cell = cell_at(&batch, next_x, next_y);
+            }
+            TEST_ASSERT_EQUAL_INT(batch.heads[i], cell);
+        }
+    }
+
+    TEST_ASSERT(best_score >= 10);
+    TEST_ASSERT(deaths > 0);
+
+    snake_batch_destroy(&batch);
+}
+
+static void test_same_seed_same_games(void) {
+    snake_batch_t a;
+    snake_batch_t b;
+    snake_batch_init(&a);
+    snake_batch_init(&b);
+    TEST_ASSERT_TRUE(snake_batch_create(&a, 32, k_grid_size, k_grid_size, 77u));
+    TEST_ASSERT_TRUE(snake_batch_create(&b, 32, k_grid_size, k_grid_size, 77u));
+
+    uint8_t actions[32];
+    for (int tick = 0; tick < 500; ++tick) {
+        for (size_t i = 0; i < 32; ++i) {
+            actions[i] = (uint8_t)((tick * 31 + (int)i * 17) % 5 == 4 ? SNAKE_BATCH_ACTION_KEEP : (uint8_t)((tick + (int)i) % 4));
+        }
+        snake_batch_step(&a, actions, NULL, NULL);
+        snake_batch_step(&b, actions, NULL, NULL);
+    }
+
+    TEST_ASSERT(memcmp(a.cell_states, b.cell_states, a.count * a.cells_per_instance) == 0);
+    TEST_ASSERT(memcmp(a.lengths, b.lengths, a.count * sizeof(uint32_t)) == 0);
+
+    snake_batch_destroy(&a);
+    snake_batch_destroy(&b);
+}
+
+static void test_parallel_step_matches_serial_step(void) {
+    enum { k_count = 1000 };
+    snake_batch_t serial;
+    snake_batch_t parallel;
+    thread_pool_t pool;
+    snake_batch_init(&serial);
+    snake_batch_init(&parallel);
+    thread_pool_init(&pool);
+    TEST_ASSERT_TRUE(snake_batch_create(&serial, k_count, k_grid_size, k_grid_size, 5u));
+    TEST_ASSERT_TRUE(snake_batch_create(&parallel, k_count, k_grid_size, k_grid_size, 5u));
+    TEST_ASSERT_TRUE(thread_pool_create(&pool, 4));
+
+    static uint8_t actions[k_count];
+    static float serial_rewards[k_count];
+    static float parallel_rewards[k_count];
+    static uint8_t serial_dones[k_count];
+    static uint8_t parallel_dones[k_count];
+    for (int tick = 0; tick < 300; ++tick) {
+        for (size_t i = 0; i < k_count; ++i) {
+            actions[i] = i % 3 == 0 ? direction_towards_food(&serial, i) : (uint8_t)((tick / 7 + (int)i) % 4);
+        }
+        snake_batch_step(&serial, actions, serial_rewards, serial_dones);
+        snake_batch_step_parallel(&parallel, &pool, actions, parallel_rewards, parallel_dones);
+
+        TEST_ASSERT(memcmp(serial_rewards, parallel_rewards, sizeof(serial_rewards)) == 0);
+        TEST_ASSERT(memcmp(serial_dones, parallel_dones, sizeof(serial_dones)) == 0);
+    }
+
+    TEST_ASSERT(memcmp(serial.cell_states, parallel.cell_states, serial.count * serial.cells_per_instance) == 0);
+    TEST_ASSERT(memcmp(serial.lengths, parallel.lengths, serial.count * sizeof(uint32_t)) == 0);
+    TEST_ASSERT(memcmp(serial.rngs, parallel.rngs, serial.count * sizeof(rng_t)) == 0);
+
+    thread_pool_destroy(&pool);
+    snake_batch_destroy(&serial);
+    snake_batch_destroy(&parallel);
+}
+
+static void test_instance_plays_like_sim(void) {
+    /* Wander with the occasional food chase, over several seeds so rounds end in different ways. */
+    for (uint64_t seed = 1; seed <= 8; ++seed) {
+        snake_batch_t batch;
+        snake_sim_t sim;
+        snake_batch_init(&batch);
+        snake_sim_init(&sim);
+        TEST_ASSERT_TRUE(snake_batch_create(&batch, 1, k_grid_size, k_grid_size, seed));
+        snake_sim_seed(&sim, seed);
+        TEST_ASSERT_TRUE(snake_sim_create(&sim, k_grid_size, k_grid_size, false));
+        TEST_ASSERT_TRUE(snake_sim_reset(&sim));
+
+        rng_t actions;
+        rng_seed(&actions, seed * 1000u);
+        size_t best_score = 0;
+        bool ended = false;
+        for (int tick = 0; tick < 5000 && ended == false; ++tick) {
+            TEST_ASSERT(memcmp(sim.cell_states, snake_batch_get_observation(&batch, 0), batch.cells_per_instance) == 0);
+            TEST_ASSERT_EQUAL_SIZE_T(snake_sim_get_score(&sim), snake_batch_get_score(&batch, 0));
+
+            uint8_t action = SNAKE_BATCH_ACTION_KEEP;
+            const uint32_t roll = rng_next_bounded(&actions, 8);
+            if (roll < 4) {
+                action = (uint8_t)roll;
+            } else if (roll < 6) {
+                action = direction_towards_food(&batch, 0);
+            }
+            if (action != SNAKE_BATCH_ACTION_KEEP) {
+                snake_sim_set_direction(&sim, (snake_direction_t)action);
+            }
+
+            snake_sim_event_t event;
+            float reward = 0.0f;
+            uint8_t done = 0;
+            TEST_ASSERT_TRUE(snake_sim_step(&sim, &event));
+            snake_batch_step(&batch, &action, &reward, &done);
+
+            TEST_ASSERT_EQUAL_INT(event == SNAKE_SIM_EVENT_COLLISION, done);
+            TEST_ASSERT_EQUAL_INT(event == SNAKE_SIM_EVENT_ATE_FOOD, reward == SNAKE_BATCH_REWARD_FOOD);
+            best_score = snake_sim_get_score(&sim) > best_score ? snake_sim_get_score(&sim) : best_score;
+            ended = done == 1;
+        }
+
+        TEST_ASSERT_TRUE(ended);
+        TEST_ASSERT(best_score > 0);
+
+        snake_sim_destroy(&sim);
+        snake_batch_destroy(&batch);
+    }
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running snake batch unit tests...\n");
+
+    run_test("test_create_starts_every_instance", test_create_starts_every_instance);
+    run_test("test_create_rejects_invalid_sizes", test_create_rejects_invalid_sizes);
+    run_test("test_eating_food_rewards_and_grows", test_eating_food_rewards_and_grows);
+    run_test("test_keep_action_wraps_around", test_keep_action_wraps_around);
+    run_test("test_moving_into_vacated_tail_is_not_a_collision", test_moving_into_vacated_tail_is_not_a_collision);
+    run_test("test_moving_into_body_ends_round_and_resets", test_moving_into_body_ends_round_and_resets);
+    run_test("test_grid_matches_bookkeeping_over_long_run", test_grid_matches_bookkeeping_over_long_run);
+    run_test("test_same_seed_same_games", test_same_seed_same_games);
+    run_test("test_parallel_step_matches_serial_step", test_parallel_step_matches_serial_step);
+    run_test("test_instance_plays_like_sim", test_instance_plays_like_sim);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d snake batch tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
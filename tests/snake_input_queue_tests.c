@@ -0,0 +1,147 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/snake_input_queue.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(value) TEST_ASSERT((value) == true)
+#define TEST_ASSERT_FALSE(value) TEST_ASSERT((value) == false)
+
+/* A freshly initialized simulation heads up, which is all these tests need from it. */
+static snake_sim_t g_sim;
+
+static void test_two_turns_in_one_tick_both_apply(void) {
+    snake_sim_init(&g_sim);
+    snake_input_queue_t queue;
+    snake_input_queue_init(&queue);
+
+    /* Left then down within one tick: down would be a reversal against left, but not against up. */
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_LEFT, 10));
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_DOWN, 20));
+    TEST_ASSERT_EQUAL_INT(2, snake_input_queue_get_count(&queue));
+
+    TEST_ASSERT_TRUE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_LEFT, g_sim.current_direction);
+    TEST_ASSERT_TRUE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_DOWN, g_sim.current_direction);
+    TEST_ASSERT_FALSE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_useless_turns_do_not_cost_a_tick(void) {
+    snake_sim_init(&g_sim);
+    snake_input_queue_t queue;
+    snake_input_queue_init(&queue);
+
+    /* A reversal and the current direction are skipped, and the right turn behind them applies on this tick. */
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_DOWN, 1));
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_UP, 2));
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_RIGHT, 3));
+
+    snake_input_t applied = {SNAKE_DIRECTION_UP, 0};
+    TEST_ASSERT_TRUE(snake_input_queue_apply_next(&queue, &g_sim, &applied));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_RIGHT, applied.direction);
+    TEST_ASSERT(applied.timestamp_ns == 3);
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_RIGHT, g_sim.current_direction);
+    TEST_ASSERT_EQUAL_INT(0, snake_input_queue_get_count(&queue));
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_repeated_turns_are_queued_once(void) {
+    snake_input_queue_t queue;
+    snake_input_queue_init(&queue);
+
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_LEFT, 1));
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_LEFT, 2));
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_LEFT, 3));
+    TEST_ASSERT_EQUAL_INT(1, snake_input_queue_get_count(&queue));
+}
+
+static void test_full_queue_drops_new_turns(void) {
+    snake_sim_init(&g_sim);
+    snake_input_queue_t queue;
+    snake_input_queue_init(&queue);
+
+    for (int i = 0; i < SNAKE_INPUT_QUEUE_CAPACITY; ++i) {
+        const snake_direction_t direction = i % 2 == 0 ? SNAKE_DIRECTION_LEFT : SNAKE_DIRECTION_DOWN;
+        TEST_ASSERT_TRUE(snake_input_queue_push(&queue, direction, (uint64_t)i));
+    }
+    TEST_ASSERT_FALSE(snake_input_queue_push(&queue, SNAKE_DIRECTION_RIGHT, 100));
+    TEST_ASSERT_EQUAL_INT(1, queue.dropped);
+    TEST_ASSERT_EQUAL_INT(SNAKE_INPUT_QUEUE_CAPACITY, snake_input_queue_get_count(&queue));
+
+    /* The queue wraps around once it drains. */
+    TEST_ASSERT_TRUE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+    TEST_ASSERT_TRUE(snake_input_queue_push(&queue, SNAKE_DIRECTION_RIGHT, 101));
+    for (int i = 1; i < SNAKE_INPUT_QUEUE_CAPACITY; ++i) {
+        TEST_ASSERT_TRUE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+    }
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_DOWN, g_sim.current_direction);
+    TEST_ASSERT_TRUE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_RIGHT, g_sim.current_direction);
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_clear_forgets_pending_turns(void) {
+    snake_sim_init(&g_sim);
+    snake_input_queue_t queue;
+    snake_input_queue_init(&queue);
+
+    for (int i = 0; i < SNAKE_INPUT_QUEUE_CAPACITY + 1; ++i) {
+        snake_input_queue_push(&queue, i % 2 == 0 ? SNAKE_DIRECTION_LEFT : SNAKE_DIRECTION_RIGHT, 0);
+    }
+    snake_input_queue_clear(&queue);
+
+    TEST_ASSERT_EQUAL_INT(0, snake_input_queue_get_count(&queue));
+    TEST_ASSERT_EQUAL_INT(0, queue.dropped);
+    TEST_ASSERT_FALSE(snake_input_queue_apply_next(&queue, &g_sim, NULL));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_UP, g_sim.current_direction);
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running snake input queue unit tests...\n");
+
+    run_test("test_two_turns_in_one_tick_both_apply", test_two_turns_in_one_tick_both_apply);
+    run_test("test_useless_turns_do_not_cost_a_tick", test_useless_turns_do_not_cost_a_tick);
+    run_test("test_repeated_turns_are_queued_once", test_repeated_turns_are_queued_once);
+    run_test("test_full_queue_drops_new_turns", test_full_queue_drops_new_turns);
+    run_test("test_clear_forgets_pending_turns", test_clear_forgets_pending_turns);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d snake input queue tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,155 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "core/snake_latency.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(value) TEST_ASSERT((value) == true)
+#define TEST_ASSERT_FALSE(value) TEST_ASSERT((value) == false)
+
+static const uint64_t k_ms = 1000000ull;
+
+static void test_stages_measure_between_their_timestamps(void) {
+    snake_latency_t latency;
+    snake_latency_init(&latency);
+
+    snake_latency_record_tick(&latency, 100 * k_ms, 105 * k_ms);
+    snake_latency_record_present(&latency, 120 * k_ms);
+
+    const snake_latency_histogram_t* const to_tick = &latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK];
+    const snake_latency_histogram_t* const to_present = &latency.histograms[SNAKE_LATENCY_STAGE_TICK_TO_PRESENT];
+    const snake_latency_histogram_t* const total = &latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_PRESENT];
+    TEST_ASSERT(to_tick->count == 1 && to_tick->max_ns == 5 * k_ms);
+    TEST_ASSERT(to_present->count == 1 && to_present->max_ns == 15 * k_ms);
+    TEST_ASSERT(total->count == 1 && total->max_ns == 20 * k_ms);
+    TEST_ASSERT_EQUAL_INT(1, total->buckets[20 * k_ms / SNAKE_LATENCY_BUCKET_NS]);
+}
+
+static void test_present_completes_every_pending_input_once(void) {
+    snake_latency_t latency;
+    snake_latency_init(&latency);
+
+    // Two ticks caught up in one frame, each applying an input.
+    snake_latency_record_tick(&latency, 0, 10 * k_ms);
+    snake_latency_record_tick(&latency, 4 * k_ms, 12 * k_ms);
+    snake_latency_record_present(&latency, 16 * k_ms);
+    snake_latency_record_present(&latency, 32 * k_ms);
+
+    const snake_latency_histogram_t* const total = &latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_PRESENT];
+    TEST_ASSERT(total->count == 2);
+    TEST_ASSERT(total->min_ns == 12 * k_ms);
+    TEST_ASSERT(total->max_ns == 16 * k_ms);
+    TEST_ASSERT_EQUAL_INT(0, latency.pending_count);
+}
+
+static void test_out_of_order_timestamps_count_as_zero(void) {
+    snake_latency_t latency;
+    snake_latency_init(&latency);
+
+    snake_latency_record_tick(&latency, 50 * k_ms, 40 * k_ms);
+    TEST_ASSERT(latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK].max_ns == 0);
+    TEST_ASSERT_EQUAL_INT(1, latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK].buckets[0]);
+}
+
+static void test_percentiles_round_up_to_bucket_edges(void) {
+    snake_latency_t latency;
+    snake_latency_init(&latency);
+
+    // 99 quick inputs and one slow one far past the last bucket edge.
+    for (int i = 0; i < 99; ++i) {
+        snake_latency_record_tick(&latency, 0, 3 * k_ms);
+    }
+    snake_latency_record_tick(&latency, 0, 500 * k_ms);
+
+    const snake_latency_histogram_t* const histogram = &latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK];
+    TEST_ASSERT(snake_latency_histogram_get_percentile(histogram, 0.5f) == 2 * SNAKE_LATENCY_BUCKET_NS);
+    TEST_ASSERT(snake_latency_histogram_get_percentile(histogram, 0.99f) == 2 * SNAKE_LATENCY_BUCKET_NS);
+    TEST_ASSERT(snake_latency_histogram_get_percentile(histogram, 1.0f) == 500 * k_ms);
+    TEST_ASSERT_EQUAL_INT(1, histogram->buckets[SNAKE_LATENCY_BUCKET_COUNT - 1]);
+
+    snake_latency_histogram_t empty;
+    memset(&empty, 0, sizeof(empty));
+    TEST_ASSERT(snake_latency_histogram_get_percentile(&empty, 0.5f) == 0);
+}
+
+static void test_percentile_never_exceeds_largest_sample(void) {
+    snake_latency_t latency;
+    snake_latency_init(&latency);
+
+    snake_latency_record_tick(&latency, 0, k_ms / 2);
+    const snake_latency_histogram_t* const histogram = &latency.histograms[SNAKE_LATENCY_STAGE_EVENT_TO_TICK];
+    TEST_ASSERT(snake_latency_histogram_get_percentile(histogram, 0.99f) == k_ms / 2);
+}
+
+static void test_report_has_a_row_per_stage_and_bucket(void) {
+    snake_latency_t latency;
+    snake_latency_init(&latency);
+    snake_latency_record_tick(&latency, 0, 3 * k_ms);
+    snake_latency_record_present(&latency, 9 * k_ms);
+
+    FILE* const file = tmpfile();
+    TEST_ASSERT(file != NULL);
+    const bool written = snake_latency_write_report(&latency, file);
+    rewind(file);
+
+    int lines = 0;
+    bool found_total = false;
+    char line[256];
+    while (fgets(line, sizeof(line), file) != NULL) {
+        lines++;
+        if (strncmp(line, "event_to_present", 16) == 0 && strstr(line, " 1 ") != NULL) {
+            found_total = true;
+        }
+    }
+    fclose(file);
+
+    TEST_ASSERT_TRUE(written);
+    TEST_ASSERT_TRUE(found_total);
+    // Comment, header and stage rows, a blank line, then the bucket header and rows.
+    TEST_ASSERT_EQUAL_INT(2 + SNAKE_LATENCY_STAGE_COUNT + 2 + SNAKE_LATENCY_BUCKET_COUNT, lines);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running snake latency unit tests...\n");
+
+    run_test("test_stages_measure_between_their_timestamps", test_stages_measure_between_their_timestamps);
+    run_test("test_present_completes_every_pending_input_once", test_present_completes_every_pending_input_once);
+    run_test("test_out_of_order_timestamps_count_as_zero", test_out_of_order_timestamps_count_as_zero);
+    run_test("test_percentiles_round_up_to_bucket_edges", test_percentiles_round_up_to_bucket_edges);
+    run_test("test_percentile_never_exceeds_largest_sample", test_percentile_never_exceeds_largest_sample);
+    run_test("test_report_has_a_row_per_stage_and_bucket", test_report_has_a_row_per_stage_and_bucket);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d snake latency tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
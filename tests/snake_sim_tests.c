@@ -0,0 +1,432 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL.h>
+
+#include "core/snake_sim.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_SIZE_T(expected, actual) TEST_ASSERT((size_t)(expected) == (size_t)(actual))
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(value) TEST_ASSERT((value) == true)
+#define TEST_ASSERT_FALSE(value) TEST_ASSERT((value) == false)
+#define TEST_ASSERT_NULL(ptr) TEST_ASSERT((ptr) == NULL)
+
+static const int k_grid_size = SNAKE_SIM_GRID_DEFAULT;
+
+static snake_sim_t g_sim;
+
+/* The outer ring of the grid is never played on and never holds food. */
+static int border_cell_count(const snake_sim_t* sim) {
+    return 2 * sim->grid_width + 2 * (sim->grid_height - 2);
+}
+
+static void poke_cell_state(snake_sim_t* sim, int x, int y, snake_cell_state_t state) {
+    sim->cell_states[y * sim->grid_width + x] = (Uint8)state;
+}
+
+static int count_cells(const snake_sim_t* sim, snake_cell_state_t state) {
+    int count = 0;
+    for (int x = 0; x < sim->grid_width; ++x) {
+        for (int y = 0; y < sim->grid_height; ++y) {
+            if (snake_sim_get_cell_state(sim, x, y) == state) {
+                ++count;
+            }
+        }
+    }
+    return count;
+}
+
+/* Steer the head one axis at a time towards the first food item. */
+static snake_direction_t direction_towards_food(const snake_sim_t* sim) {
+    const vector2i_t* food = (const vector2i_t*)dynamic_array_get(&sim->array_food, 0);
+    if (food->x < sim->position_head.x) {
+        return SNAKE_DIRECTION_LEFT;
+    }
+    if (food->x > sim->position_head.x) {
+        return SNAKE_DIRECTION_RIGHT;
+    }
+    return food->y < sim->position_head.y ? SNAKE_DIRECTION_UP : SNAKE_DIRECTION_DOWN;
+}
+
+/* Replace the board with a snake whose head is at head and whose body follows the given segments. */
+static void place_snake(snake_sim_t* sim, vector2i_t head, const vector2i_t* body, size_t body_count,
+                        snake_direction_t direction) {
+    for (int x = 0; x < sim->grid_width; ++x) {
+        for (int y = 0; y < sim->grid_height; ++y) {
+            poke_cell_state(sim, x, y, SNAKE_CELL_EMPTY);
+        }
+    }
+    dynamic_array_clear(&sim->array_food);
+    ring_buffer_clear(&sim->array_body);
+
+    sim->position_head = head;
+    poke_cell_state(sim, head.x, head.y, SNAKE_CELL_SNAKE);
+    for (size_t i = 0; i < body_count; ++i) {
+        ring_buffer_push_back(&sim->array_body, &body[i]);
+        poke_cell_state(sim, body[i].x, body[i].y, SNAKE_CELL_SNAKE);
+    }
+    sim->current_direction = direction;
+}
+
+static void test_reset_places_head_and_food(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 42u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, false));
+
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+    TEST_ASSERT_TRUE(g_sim.is_alive);
+    TEST_ASSERT_EQUAL_SIZE_T(0, snake_sim_get_score(&g_sim));
+    TEST_ASSERT_EQUAL_SIZE_T(SNAKE_SIM_FOOD_COUNT, g_sim.array_food.size);
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_FOOD_COUNT, count_cells(&g_sim, SNAKE_CELL_FOOD));
+    TEST_ASSERT_EQUAL_INT(1, count_cells(&g_sim, SNAKE_CELL_SNAKE));
+    TEST_ASSERT_EQUAL_SIZE_T((k_grid_size - 2) * (k_grid_size - 2) - 1 - SNAKE_SIM_FOOD_COUNT, g_sim.free_cells.size);
+    TEST_ASSERT_EQUAL_INT(SNAKE_CELL_SNAKE,
+                          snake_sim_get_cell_state(&g_sim, g_sim.position_head.x, g_sim.position_head.y));
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_step_moves_and_wraps(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 7u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, false));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+
+    /* Clear the column above the head so the run is not interrupted by food. */
+    const int start_x = g_sim.position_head.x;
+    for (size_t i = 0; i < g_sim.array_food.size; ++i) {
+        const vector2i_t* food = (const vector2i_t*)dynamic_array_get(&g_sim.array_food, i);
+        if (food->x == start_x) {
+            poke_cell_state(&g_sim, food->x, food->y, SNAKE_CELL_EMPTY);
+            sparse_set_insert(&g_sim.free_cells, (uint32_t)(food->y * g_sim.grid_width + food->x));
+        }
+    }
+    dynamic_array_clear(&g_sim.array_food);
+
+    const int start_y = g_sim.position_head.y;
+    snake_sim_event_t event;
+    for (int i = 0; i < k_grid_size - 2; ++i) {
+        TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+        TEST_ASSERT_EQUAL_INT(SNAKE_SIM_EVENT_NONE, event);
+        TEST_ASSERT(g_sim.position_head.y >= 1 && g_sim.position_head.y <= k_grid_size - 2);
+
+        /* Every move is one cell up, including the one through the top border. */
+        const vector2i_t delta = snake_sim_get_step_delta(&g_sim, &g_sim.previous_position_head, &g_sim.position_head);
+        TEST_ASSERT_EQUAL_INT(0, delta.x);
+        TEST_ASSERT_EQUAL_INT(-1, delta.y);
+    }
+
+    /* A full lap of the interior brings the head back to where it started. */
+    TEST_ASSERT_EQUAL_INT(start_x, g_sim.position_head.x);
+    TEST_ASSERT_EQUAL_INT(start_y, g_sim.position_head.y);
+    TEST_ASSERT_EQUAL_INT(1, count_cells(&g_sim, SNAKE_CELL_SNAKE));
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_set_direction_rejects_reversal(void) {
+    snake_sim_init(&g_sim);
+
+    TEST_ASSERT_FALSE(snake_sim_set_direction(&g_sim, SNAKE_DIRECTION_DOWN));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_UP, g_sim.current_direction);
+    TEST_ASSERT_TRUE(snake_sim_set_direction(&g_sim, SNAKE_DIRECTION_LEFT));
+    TEST_ASSERT_FALSE(snake_sim_set_direction(&g_sim, SNAKE_DIRECTION_RIGHT));
+    TEST_ASSERT_EQUAL_INT(SNAKE_DIRECTION_LEFT, g_sim.current_direction);
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_eating_food_grows_snake(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 1234u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, true));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+
+    snake_sim_event_t event = SNAKE_SIM_EVENT_NONE;
+    int ticks = 0;
+    while (event != SNAKE_SIM_EVENT_ATE_FOOD && ticks < k_grid_size * k_grid_size) {
+        snake_sim_set_direction(&g_sim, direction_towards_food(&g_sim));
+        TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+        TEST_ASSERT(event != SNAKE_SIM_EVENT_COLLISION);
+        ++ticks;
+    }
+
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_EVENT_ATE_FOOD, event);
+    TEST_ASSERT_EQUAL_SIZE_T(1, snake_sim_get_score(&g_sim));
+    TEST_ASSERT_EQUAL_SIZE_T(SNAKE_SIM_FOOD_COUNT, g_sim.array_food.size);
+    TEST_ASSERT_EQUAL_INT(2, count_cells(&g_sim, SNAKE_CELL_SNAKE));
+
+    /* The gradient shades the head brightest and fades towards the tail. */
+    TEST_ASSERT_EQUAL_SIZE_T(2, g_sim.segment_colors.size);
+    const SDL_Color head_color = snake_sim_get_segment_color(&g_sim, 0);
+    const SDL_Color neck_color = snake_sim_get_segment_color(&g_sim, 1);
+    TEST_ASSERT_EQUAL_INT(255, head_color.g);
+    TEST_ASSERT(neck_color.g < head_color.g);
+    TEST_ASSERT(neck_color.g >= 120);
+
+    /* Board colors follow the cell state, independent of the gradient. */
+    const SDL_Color board_color = snake_sim_get_cell_color(&g_sim, g_sim.position_head.x, g_sim.position_head.y);
+    TEST_ASSERT_EQUAL_INT(255, board_color.g);
+    TEST_ASSERT_EQUAL_INT(255, board_color.a);
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_moving_into_vacated_tail_is_not_a_collision(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 5u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, false));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+
+    /* Head at the top-left of a 2x2 loop, tail directly below it. */
+    const vector2i_t body[] = {{11, 10}, {11, 11}, {10, 11}};
+    place_snake(&g_sim, (vector2i_t){10, 10}, body, 3, SNAKE_DIRECTION_DOWN);
+
+    snake_sim_event_t event;
+    TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_EVENT_NONE, event);
+    TEST_ASSERT_TRUE(g_sim.is_alive);
+    TEST_ASSERT_EQUAL_INT(10, g_sim.position_head.x);
+    TEST_ASSERT_EQUAL_INT(11, g_sim.position_head.y);
+    TEST_ASSERT_EQUAL_INT(4, count_cells(&g_sim, SNAKE_CELL_SNAKE));
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_moving_into_body_is_a_collision(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 6u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, false));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+
+    /* Same loop but one segment longer, so the cell below the head stays occupied. */
+    const vector2i_t body[] = {{11, 10}, {11, 11}, {10, 11}, {10, 12}};
+    place_snake(&g_sim, (vector2i_t){10, 10}, body, 4, SNAKE_DIRECTION_DOWN);
+
+    snake_sim_event_t event;
+    TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_EVENT_COLLISION, event);
+    TEST_ASSERT_FALSE(g_sim.is_alive);
+    TEST_ASSERT_EQUAL_INT(10, g_sim.position_head.x);
+    TEST_ASSERT_EQUAL_INT(10, g_sim.position_head.y);
+    TEST_ASSERT_EQUAL_SIZE_T(4, snake_sim_get_score(&g_sim));
+
+    snake_sim_destroy(&g_sim);
+}
+
+/* Chase food for a while, restarting on death, and check the grid never drifts from the body and food lists. */
+static void run_and_check_grid(uint64_t seed, int grid_width, int grid_height, bool with_colors,
+                               size_t min_best_score) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, seed);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, grid_width, grid_height, with_colors));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+
+    size_t best_score = 0;
+    for (int tick = 0; tick < 4000; ++tick) {
+        snake_sim_set_direction(&g_sim, direction_towards_food(&g_sim));
+
+        snake_sim_event_t event;
+        TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+        if (event == SNAKE_SIM_EVENT_COLLISION) {
+            TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+            continue;
+        }
+
+        const size_t score = snake_sim_get_score(&g_sim);
+        best_score = score > best_score ? score : best_score;
+        TEST_ASSERT_EQUAL_INT((int)score + 1, count_cells(&g_sim, SNAKE_CELL_SNAKE));
+        TEST_ASSERT_EQUAL_INT((int)g_sim.array_food.size, count_cells(&g_sim, SNAKE_CELL_FOOD));
+        TEST_ASSERT_EQUAL_INT(count_cells(&g_sim, SNAKE_CELL_EMPTY) - border_cell_count(&g_sim),
+                              (int)g_sim.free_cells.size);
+        if (with_colors == true) {
+            TEST_ASSERT_EQUAL_SIZE_T(score + 1, g_sim.segment_colors.size);
+        }
+    }
+
+    TEST_ASSERT(best_score >= min_best_score);
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_grid_matches_body_over_long_run(void) {
+    run_and_check_grid(2024u, k_grid_size, k_grid_size, false, 10);
+}
+
+static void test_non_square_grid_matches_body_over_long_run(void) {
+    run_and_check_grid(77u, SNAKE_SIM_GRID_MIN, 3 * SNAKE_SIM_GRID_MIN, true, 5);
+}
+
+static void test_create_rejects_out_of_range_grid(void) {
+    snake_sim_init(&g_sim);
+
+    TEST_ASSERT_FALSE(snake_sim_create(&g_sim, SNAKE_SIM_GRID_MIN - 1, k_grid_size, false));
+    TEST_ASSERT_FALSE(snake_sim_create(&g_sim, k_grid_size, SNAKE_SIM_GRID_MAX + 1, false));
+    TEST_ASSERT_NULL(g_sim.cell_states);
+
+    /* Re-creating swaps the grid for one of the new size. */
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, false));
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, 20, 30, false));
+    TEST_ASSERT_EQUAL_INT(20, g_sim.grid_width);
+    TEST_ASSERT_EQUAL_INT(30, g_sim.grid_height);
+    TEST_ASSERT_EQUAL_SIZE_T(20 * 30, g_sim.free_cells.universe);
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+    TEST_ASSERT_EQUAL_SIZE_T(18 * 28 - 1 - SNAKE_SIM_FOOD_COUNT, g_sim.free_cells.size);
+
+    snake_sim_destroy(&g_sim);
+    TEST_ASSERT_NULL(g_sim.cell_states);
+}
+
+/* Play a fixed input pattern and fold every head and food position into a fingerprint. */
+static uint64_t play_and_fingerprint(snake_sim_t* sim, uint64_t seed) {
+    snake_sim_init(sim);
+    snake_sim_seed(sim, seed);
+    if (snake_sim_create(sim, k_grid_size, k_grid_size, false) == false || snake_sim_reset(sim) == false) {
+        return 0;
+    }
+
+    uint64_t fingerprint = 1469598103934665603ULL;
+    for (int tick = 0; tick < 2000; ++tick) {
+        snake_sim_set_direction(sim, direction_towards_food(sim));
+
+        snake_sim_event_t event;
+        snake_sim_step(sim, &event);
+        if (event == SNAKE_SIM_EVENT_COLLISION) {
+            snake_sim_reset(sim);
+        }
+
+        const vector2i_t* food = (const vector2i_t*)dynamic_array_get(&sim->array_food, 0);
+        fingerprint = (fingerprint ^ (uint64_t)(sim->position_head.y * k_grid_size + sim->position_head.x)) *
+                      1099511628211ULL;
+        fingerprint = (fingerprint ^ (uint64_t)(food->y * k_grid_size + food->x)) * 1099511628211ULL;
+    }
+
+    snake_sim_destroy(sim);
+    return fingerprint;
+}
+
+static void test_same_seed_replays_same_game(void) {
+    static snake_sim_t other;
+
+    const uint64_t first = play_and_fingerprint(&g_sim, 31337u);
+    const uint64_t second = play_and_fingerprint(&other, 31337u);
+    const uint64_t different = play_and_fingerprint(&other, 31338u);
+
+    TEST_ASSERT(first != 0);
+    TEST_ASSERT(first == second);
+    TEST_ASSERT(first != different);
+}
+
+static void test_step_after_death_is_noop(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 99u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, false));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+
+    g_sim.is_alive = false;
+    const vector2i_t head = g_sim.position_head;
+
+    snake_sim_event_t event;
+    TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+    TEST_ASSERT_EQUAL_INT(SNAKE_SIM_EVENT_NONE, event);
+    TEST_ASSERT_TRUE(vector2i_equals(&head, &g_sim.position_head));
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void test_dirty_cells_keep_a_copy_in_sync(void) {
+    snake_sim_init(&g_sim);
+    snake_sim_seed(&g_sim, 99u);
+    TEST_ASSERT_TRUE(snake_sim_create(&g_sim, k_grid_size, k_grid_size, true));
+    TEST_ASSERT_TRUE(snake_sim_needs_full_redraw(&g_sim));
+    TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+    TEST_ASSERT_TRUE(snake_sim_needs_full_redraw(&g_sim));
+
+    /* Mirror the color plane the way a renderer would, patching only what the simulation reports. */
+    const size_t cell_count = (size_t)k_grid_size * (size_t)k_grid_size;
+    static SDL_Color copy[SNAKE_SIM_GRID_DEFAULT * SNAKE_SIM_GRID_DEFAULT];
+    memcpy(copy, g_sim.cell_colors, cell_count * sizeof(SDL_Color));
+    snake_sim_clear_dirty(&g_sim);
+
+    size_t dirty_count = 0;
+    snake_sim_get_dirty_cells(&g_sim, &dirty_count);
+    TEST_ASSERT_EQUAL_SIZE_T(0, dirty_count);
+    TEST_ASSERT_FALSE(snake_sim_needs_full_redraw(&g_sim));
+
+    for (int tick = 0; tick < 2000; ++tick) {
+        snake_sim_set_direction(&g_sim, direction_towards_food(&g_sim));
+        snake_sim_event_t event;
+        TEST_ASSERT_TRUE(snake_sim_step(&g_sim, &event));
+        if (event == SNAKE_SIM_EVENT_COLLISION) {
+            TEST_ASSERT_TRUE(snake_sim_reset(&g_sim));
+        }
+
+        if (snake_sim_needs_full_redraw(&g_sim) == true) {
+            memcpy(copy, g_sim.cell_colors, cell_count * sizeof(SDL_Color));
+        } else {
+            const uint32_t* const cells = snake_sim_get_dirty_cells(&g_sim, &dirty_count);
+            /* At most the new head, the vacated tail and one respawned food item. */
+            TEST_ASSERT(dirty_count <= 3);
+            for (size_t i = 0; i < dirty_count; ++i) {
+                TEST_ASSERT(cells[i] < cell_count);
+                copy[cells[i]] = g_sim.cell_colors[cells[i]];
+            }
+        }
+        snake_sim_clear_dirty(&g_sim);
+
+        TEST_ASSERT(memcmp(copy, g_sim.cell_colors, cell_count * sizeof(SDL_Color)) == 0);
+    }
+
+    snake_sim_destroy(&g_sim);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running snake simulation unit tests...\n");
+
+    run_test("test_reset_places_head_and_food", test_reset_places_head_and_food);
+    run_test("test_step_moves_and_wraps", test_step_moves_and_wraps);
+    run_test("test_set_direction_rejects_reversal", test_set_direction_rejects_reversal);
+    run_test("test_eating_food_grows_snake", test_eating_food_grows_snake);
+    run_test("test_moving_into_vacated_tail_is_not_a_collision", test_moving_into_vacated_tail_is_not_a_collision);
+    run_test("test_moving_into_body_is_a_collision", test_moving_into_body_is_a_collision);
+    run_test("test_grid_matches_body_over_long_run", test_grid_matches_body_over_long_run);
+    run_test("test_non_square_grid_matches_body_over_long_run", test_non_square_grid_matches_body_over_long_run);
+    run_test("test_create_rejects_out_of_range_grid", test_create_rejects_out_of_range_grid);
+    run_test("test_same_seed_replays_same_game", test_same_seed_replays_same_game);
+    run_test("test_step_after_death_is_noop", test_step_after_death_is_noop);
+    run_test("test_dirty_cells_keep_a_copy_in_sync", test_dirty_cells_keep_a_copy_in_sync);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d snake simulation tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
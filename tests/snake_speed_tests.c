@@ -0,0 +1,104 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "core/snake_speed.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+
+/* Checks a rate as a value, whatever fraction it is written as. */
+#define TEST_ASSERT_RATE(expected_numerator, expected_denominator, rate)                     \
+    TEST_ASSERT((uint64_t)(rate).numerator * (uint64_t)(expected_denominator) ==             \
+                (uint64_t)(expected_numerator) * (uint64_t)(rate).denominator)
+
+static void test_defaults_match_the_classic_game(void) {
+    snake_speed_t speed;
+    snake_speed_set_defaults(&speed);
+
+    TEST_ASSERT_EQUAL_INT(SNAKE_SPEED_CURVE_CONSTANT, speed.curve);
+    TEST_ASSERT_RATE(8, 1, snake_speed_get_rate(&speed, 0));
+    TEST_ASSERT_RATE(8, 1, snake_speed_get_rate(&speed, 1000));
+}
+
+static void test_constant_curve_ignores_score(void) {
+    const snake_speed_t speed = {SNAKE_SPEED_CURVE_CONSTANT, 12, 30, 2};
+
+    TEST_ASSERT_RATE(12, 1, snake_speed_get_rate(&speed, 0));
+    TEST_ASSERT_RATE(12, 1, snake_speed_get_rate(&speed, 500));
+}
+
+static void test_linear_curve_gains_a_fraction_per_point(void) {
+    const snake_speed_t speed = {SNAKE_SPEED_CURVE_LINEAR, 8, 10, 4};
+
+    TEST_ASSERT_RATE(8, 1, snake_speed_get_rate(&speed, 0));
+    TEST_ASSERT_RATE(33, 4, snake_speed_get_rate(&speed, 1));
+    TEST_ASSERT_RATE(17, 2, snake_speed_get_rate(&speed, 2));
+    TEST_ASSERT_RATE(9, 1, snake_speed_get_rate(&speed, 4));
+    TEST_ASSERT_RATE(39, 4, snake_speed_get_rate(&speed, 7));
+    TEST_ASSERT_RATE(10, 1, snake_speed_get_rate(&speed, 8));
+    TEST_ASSERT_RATE(10, 1, snake_speed_get_rate(&speed, 9));
+}
+
+static void test_stepped_curve_jumps_every_step(void) {
+    const snake_speed_t speed = {SNAKE_SPEED_CURVE_STEPPED, 8, 10, 3};
+
+    TEST_ASSERT_RATE(8, 1, snake_speed_get_rate(&speed, 2));
+    TEST_ASSERT_RATE(9, 1, snake_speed_get_rate(&speed, 3));
+    TEST_ASSERT_RATE(9, 1, snake_speed_get_rate(&speed, 5));
+    TEST_ASSERT_RATE(10, 1, snake_speed_get_rate(&speed, 6));
+    TEST_ASSERT_RATE(10, 1, snake_speed_get_rate(&speed, 100));
+}
+
+static void test_huge_score_stays_at_max(void) {
+    const snake_speed_t linear = {SNAKE_SPEED_CURVE_LINEAR, SNAKE_SPEED_RATE_MIN, SNAKE_SPEED_RATE_MAX,
+                                  SNAKE_SPEED_STEP_MAX};
+    const snake_speed_t stepped = {SNAKE_SPEED_CURVE_STEPPED, SNAKE_SPEED_RATE_MIN, SNAKE_SPEED_RATE_MAX,
+                                   SNAKE_SPEED_STEP_MIN};
+
+    /* A full maximum-size board, well past where either curve tops out. */
+    const size_t score = (size_t)4094 * 4094;
+    TEST_ASSERT_RATE(SNAKE_SPEED_RATE_MAX, 1, snake_speed_get_rate(&linear, score));
+    TEST_ASSERT_RATE(SNAKE_SPEED_RATE_MAX, 1, snake_speed_get_rate(&stepped, score));
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running snake speed unit tests...\n");
+
+    run_test("test_defaults_match_the_classic_game", test_defaults_match_the_classic_game);
+    run_test("test_constant_curve_ignores_score", test_constant_curve_ignores_score);
+    run_test("test_linear_curve_gains_a_fraction_per_point", test_linear_curve_gains_a_fraction_per_point);
+    run_test("test_stepped_curve_jumps_every_step", test_stepped_curve_jumps_every_step);
+    run_test("test_huge_score_stays_at_max", test_huge_score_stays_at_max);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d snake speed tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,171 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdint.h>
+
+#include "utils/sparse_set.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_SIZE_T(expected, actual) TEST_ASSERT((size_t)(expected) == (size_t)(actual))
+#define TEST_ASSERT_NOT_NULL(ptr) TEST_ASSERT((ptr) != NULL)
+#define TEST_ASSERT_NULL(ptr) TEST_ASSERT((ptr) == NULL)
+
+static void test_create_and_destroy(void) {
+    sparse_set_t set;
+    sparse_set_init(&set);
+
+    TEST_ASSERT_NULL(set.dense);
+    TEST_ASSERT_NULL(set.sparse);
+    TEST_ASSERT_EQUAL_SIZE_T(0, set.size);
+
+    TEST_ASSERT(sparse_set_create(&set, 16));
+
+    TEST_ASSERT_NOT_NULL(set.dense);
+    TEST_ASSERT_NOT_NULL(set.sparse);
+    TEST_ASSERT_EQUAL_SIZE_T(0, set.size);
+    TEST_ASSERT_EQUAL_SIZE_T(16, set.universe);
+
+    sparse_set_destroy(&set);
+
+    TEST_ASSERT_NULL(set.dense);
+    TEST_ASSERT_NULL(set.sparse);
+    TEST_ASSERT_EQUAL_SIZE_T(0, set.universe);
+}
+
+static void test_insert_and_contains(void) {
+    sparse_set_t set;
+    sparse_set_init(&set);
+    TEST_ASSERT(sparse_set_create(&set, 16));
+
+    sparse_set_insert(&set, 3);
+    sparse_set_insert(&set, 15);
+    sparse_set_insert(&set, 3);
+
+    TEST_ASSERT_EQUAL_SIZE_T(2, set.size);
+    TEST_ASSERT(sparse_set_contains(&set, 3));
+    TEST_ASSERT(sparse_set_contains(&set, 15));
+    TEST_ASSERT(sparse_set_contains(&set, 0) == false);
+    TEST_ASSERT(sparse_set_contains(&set, 7) == false);
+
+    sparse_set_destroy(&set);
+}
+
+static void test_remove_swaps_last_member(void) {
+    sparse_set_t set;
+    sparse_set_init(&set);
+    TEST_ASSERT(sparse_set_create(&set, 16));
+
+    for (uint32_t i = 0; i < 5; ++i) {
+        sparse_set_insert(&set, i * 2);
+    }
+
+    sparse_set_remove(&set, 2);
+    sparse_set_remove(&set, 5);
+
+    TEST_ASSERT_EQUAL_SIZE_T(4, set.size);
+    TEST_ASSERT(sparse_set_contains(&set, 2) == false);
+    TEST_ASSERT_EQUAL_SIZE_T(0, sparse_set_get(&set, 0));
+    TEST_ASSERT_EQUAL_SIZE_T(8, sparse_set_get(&set, 1));
+    TEST_ASSERT_EQUAL_SIZE_T(4, sparse_set_get(&set, 2));
+    TEST_ASSERT_EQUAL_SIZE_T(6, sparse_set_get(&set, 3));
+
+    /* Every remaining member must still be reachable after the swap. */
+    for (size_t i = 0; i < set.size; ++i) {
+        TEST_ASSERT(sparse_set_contains(&set, sparse_set_get(&set, i)));
+    }
+
+    sparse_set_destroy(&set);
+}
+
+static void test_clear_forgets_members(void) {
+    sparse_set_t set;
+    sparse_set_init(&set);
+    TEST_ASSERT(sparse_set_create(&set, 8));
+
+    sparse_set_insert(&set, 1);
+    sparse_set_insert(&set, 6);
+    sparse_set_clear(&set);
+
+    TEST_ASSERT_EQUAL_SIZE_T(0, set.size);
+    TEST_ASSERT(sparse_set_contains(&set, 1) == false);
+    TEST_ASSERT(sparse_set_contains(&set, 6) == false);
+
+    sparse_set_insert(&set, 6);
+    TEST_ASSERT_EQUAL_SIZE_T(1, set.size);
+    TEST_ASSERT(sparse_set_contains(&set, 6));
+    TEST_ASSERT(sparse_set_contains(&set, 1) == false);
+
+    sparse_set_destroy(&set);
+}
+
+static void test_create_rejects_overflow(void) {
+    sparse_set_t set;
+    sparse_set_init(&set);
+
+    TEST_ASSERT(sparse_set_create(&set, SIZE_MAX) == false);
+    TEST_ASSERT_NULL(set.dense);
+    TEST_ASSERT_EQUAL_SIZE_T(0, set.universe);
+}
+
+static void test_attached_sets_share_storage(void) {
+    uint32_t dense[16];
+    uint32_t sparse[16] = {0};
+    sparse_set_t a;
+    sparse_set_t b;
+    sparse_set_attach(&a, 8, dense, sparse);
+    sparse_set_attach(&b, 8, dense + 8, sparse + 8);
+
+    sparse_set_insert(&a, 7);
+    sparse_set_insert(&b, 7);
+    sparse_set_insert(&b, 2);
+    sparse_set_remove(&a, 7);
+
+    TEST_ASSERT_EQUAL_SIZE_T(0, a.size);
+    TEST_ASSERT_EQUAL_SIZE_T(2, b.size);
+    TEST_ASSERT(sparse_set_contains(&b, 7));
+    TEST_ASSERT(sparse_set_contains(&b, 2));
+    TEST_ASSERT(dense == a.dense);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running sparse set unit tests...\n");
+
+    run_test("test_create_and_destroy", test_create_and_destroy);
+    run_test("test_insert_and_contains", test_insert_and_contains);
+    run_test("test_remove_swaps_last_member", test_remove_swaps_last_member);
+    run_test("test_clear_forgets_members", test_clear_forgets_members);
+    run_test("test_create_rejects_overflow", test_create_rejects_overflow);
+    run_test("test_attached_sets_share_storage", test_attached_sets_share_storage);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d sparse set tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
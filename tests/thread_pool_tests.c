@@ -0,0 +1,139 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <SDL3/SDL_atomic.h>
+
+#include "utils/thread_pool.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(value) TEST_ASSERT((value) == true)
+#define TEST_ASSERT_FALSE(value) TEST_ASSERT((value) == false)
+
+enum { k_item_count = 10007 };
+
+typedef struct {
+    SDL_AtomicInt visits[k_item_count];
+    SDL_AtomicInt calls;
+} visit_counter_t;
+
+static void count_visits(void* user_data, size_t begin, size_t end) {
+    visit_counter_t* const counter = (visit_counter_t*)user_data;
+    SDL_AddAtomicInt(&counter->calls, 1);
+    for (size_t i = begin; i < end; ++i) {
+        SDL_AddAtomicInt(&counter->visits[i], 1);
+    }
+}
+
+static int run_and_count_misses(thread_pool_t* pool, visit_counter_t* counter, size_t count, size_t chunk_size) {
+    memset(counter, 0, sizeof(*counter));
+    thread_pool_parallel_for(pool, count, chunk_size, count_visits, counter);
+
+    int misses = 0;
+    for (size_t i = 0; i < k_item_count; ++i) {
+        const int expected = i < count ? 1 : 0;
+        if (SDL_GetAtomicInt(&counter->visits[i]) != expected) {
+            ++misses;
+        }
+    }
+    return misses;
+}
+
+static void test_create_rejects_invalid_sizes(void) {
+    thread_pool_t pool;
+    thread_pool_init(&pool);
+
+    TEST_ASSERT_FALSE(thread_pool_create(&pool, 0));
+    TEST_ASSERT_FALSE(thread_pool_create(&pool, THREAD_POOL_MAX_WORKERS + 1));
+}
+
+static void test_single_worker_runs_on_caller(void) {
+    static visit_counter_t counter;
+    thread_pool_t pool;
+    thread_pool_init(&pool);
+    TEST_ASSERT_TRUE(thread_pool_create(&pool, 1));
+
+    TEST_ASSERT_EQUAL_INT(0, run_and_count_misses(&pool, &counter, k_item_count, 100));
+    TEST_ASSERT_EQUAL_INT(101, SDL_GetAtomicInt(&counter.calls));
+
+    thread_pool_destroy(&pool);
+}
+
+static void test_every_index_visited_once(void) {
+    static visit_counter_t counter;
+    thread_pool_t pool;
+    thread_pool_init(&pool);
+    TEST_ASSERT_TRUE(thread_pool_create(&pool, 4));
+
+    // Repeated runs reuse the same threads; uneven counts leave a short final chunk.
+    for (int run = 0; run < 50; ++run) {
+        const size_t count = k_item_count - (size_t)run * 37;
+        TEST_ASSERT_EQUAL_INT(0, run_and_count_misses(&pool, &counter, count, 1 + (size_t)run % 9));
+    }
+
+    thread_pool_destroy(&pool);
+}
+
+static void test_fewer_chunks_than_workers(void) {
+    static visit_counter_t counter;
+    thread_pool_t pool;
+    thread_pool_init(&pool);
+    TEST_ASSERT_TRUE(thread_pool_create(&pool, 8));
+
+    TEST_ASSERT_EQUAL_INT(0, run_and_count_misses(&pool, &counter, 3, 1));
+    TEST_ASSERT_EQUAL_INT(3, SDL_GetAtomicInt(&counter.calls));
+    TEST_ASSERT_EQUAL_INT(0, run_and_count_misses(&pool, &counter, 0, 1));
+    TEST_ASSERT_EQUAL_INT(0, SDL_GetAtomicInt(&counter.calls));
+
+    thread_pool_destroy(&pool);
+}
+
+static void test_destroy_without_create(void) {
+    thread_pool_t pool;
+    thread_pool_init(&pool);
+    thread_pool_destroy(&pool);
+    TEST_ASSERT_EQUAL_INT(0, pool.worker_count);
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running thread pool unit tests...\n");
+
+    run_test("test_create_rejects_invalid_sizes", test_create_rejects_invalid_sizes);
+    run_test("test_single_worker_runs_on_caller", test_single_worker_runs_on_caller);
+    run_test("test_every_index_visited_once", test_every_index_visited_once);
+    run_test("test_fewer_chunks_than_workers", test_fewer_chunks_than_workers);
+    run_test("test_destroy_without_create", test_destroy_without_create);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d thread pool tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,134 @@
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "modules/timestep.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_FLOAT_CLOSE(expected, actual) TEST_ASSERT(fabsf((expected) - (actual)) < 0.0001f)
+
+/**
+ * @brief Advance in frames of frame_length until time_end and count every tick handed out.
+ */
+static int run_frames(timestep_t* step, Uint64 time_start, Uint64 time_end, Uint64 frame_length) {
+    int total = 0;
+    for (Uint64 time = time_start + frame_length; time <= time_end; time += frame_length) {
+        total += timestep_advance(step, time);
+    }
+    return total;
+}
+
+static void test_uneven_rate_does_not_drift(void) {
+    timestep_t step;
+    timestep_init(&step, 7, 1, 4, 0);
+
+    // A 7 Hz tick is not a whole number of milliseconds or of 3 ms frames, yet a minute is still exactly 420 ticks.
+    TEST_ASSERT_EQUAL_INT(420, run_frames(&step, 0, 60 * SDL_NS_PER_SECOND, 3 * SDL_NS_PER_MS));
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, timestep_get_alpha(&step));
+}
+
+static void test_fractional_rate(void) {
+    timestep_t step;
+    timestep_init(&step, 17, 2, 4, 0);
+
+    TEST_ASSERT_EQUAL_INT(17, run_frames(&step, 0, 2 * SDL_NS_PER_SECOND, SDL_NS_PER_MS));
+}
+
+static void test_alpha_tracks_the_current_tick(void) {
+    timestep_t step;
+    timestep_init(&step, 4, 1, 4, 1000);
+
+    const Uint64 tick = SDL_NS_PER_SECOND / 4;
+    TEST_ASSERT_EQUAL_INT(0, timestep_advance(&step, 1000 + tick / 4));
+    TEST_ASSERT_FLOAT_CLOSE(0.25f, timestep_get_alpha(&step));
+    TEST_ASSERT_EQUAL_INT(1, timestep_advance(&step, 1000 + tick + tick / 2));
+    TEST_ASSERT_FLOAT_CLOSE(0.5f, timestep_get_alpha(&step));
+}
+
+static void test_stall_is_capped(void) {
+    timestep_t step;
+    timestep_init(&step, 8, 1, 3, 0);
+
+    const Uint64 tick = SDL_NS_PER_SECOND / 8;
+    TEST_ASSERT_EQUAL_INT(3, timestep_advance(&step, 100 * SDL_NS_PER_SECOND));
+    TEST_ASSERT(timestep_get_alpha(&step) < 1.0f);
+    // The backlog is gone: the next frame only gets what passed since the stall.
+    TEST_ASSERT_EQUAL_INT(1, timestep_advance(&step, 100 * SDL_NS_PER_SECOND + tick));
+}
+
+static void test_time_going_backwards_runs_nothing(void) {
+    timestep_t step;
+    timestep_init(&step, 8, 1, 4, SDL_NS_PER_SECOND);
+
+    TEST_ASSERT_EQUAL_INT(0, timestep_advance(&step, 0));
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, timestep_get_alpha(&step));
+}
+
+static void test_rate_change_keeps_progress(void) {
+    timestep_t step;
+    timestep_init(&step, 10, 1, 4, 0);
+
+    TEST_ASSERT_EQUAL_INT(0, timestep_advance(&step, SDL_NS_PER_SECOND / 20));
+    TEST_ASSERT_FLOAT_CLOSE(0.5f, timestep_get_alpha(&step));
+
+    timestep_set_rate(&step, 3, 2);
+    TEST_ASSERT_FLOAT_CLOSE(0.5f, timestep_get_alpha(&step));
+    // Half of a 2/3 s tick is left.
+    TEST_ASSERT_EQUAL_INT(0, timestep_advance(&step, SDL_NS_PER_SECOND / 20 + SDL_NS_PER_SECOND / 3 - 1000));
+    TEST_ASSERT_EQUAL_INT(1, timestep_advance(&step, SDL_NS_PER_SECOND / 20 + SDL_NS_PER_SECOND / 3 + 1000));
+}
+
+static void test_reset_drops_accumulated_time(void) {
+    timestep_t step;
+    timestep_init(&step, 8, 1, 4, 0);
+
+    TEST_ASSERT_EQUAL_INT(0, timestep_advance(&step, SDL_NS_PER_SECOND / 10));
+    timestep_reset(&step, 5 * SDL_NS_PER_SECOND);
+    TEST_ASSERT_FLOAT_CLOSE(0.0f, timestep_get_alpha(&step));
+    TEST_ASSERT_EQUAL_INT(0, timestep_advance(&step, 5 * SDL_NS_PER_SECOND + SDL_NS_PER_SECOND / 10));
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running timestep unit tests...\n");
+
+    run_test("test_uneven_rate_does_not_drift", test_uneven_rate_does_not_drift);
+    run_test("test_fractional_rate", test_fractional_rate);
+    run_test("test_alpha_tracks_the_current_tick", test_alpha_tracks_the_current_tick);
+    run_test("test_stall_is_capped", test_stall_is_capped);
+    run_test("test_time_going_backwards_runs_nothing", test_time_going_backwards_runs_nothing);
+    run_test("test_rate_change_keeps_progress", test_rate_change_keeps_progress);
+    run_test("test_reset_drops_accumulated_time", test_reset_drops_accumulated_time);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d timestep tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
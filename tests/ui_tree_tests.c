@@ -0,0 +1,164 @@
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "modules/ui_tree.h"
+
+typedef void (*test_fn_t)(void);
+
+static int g_failures = 0;
+static int g_tests_run = 0;
+static const char* g_current_test = NULL;
+
+#define TEST_ASSERT(cond)                                                                                \
+    do {                                                                                                 \
+        if (!(cond)) {                                                                                   \
+            fprintf(stderr, "[  FAILED  ] %s: %s (%s:%d)\n", g_current_test, #cond, __FILE__, __LINE__); \
+            ++g_failures;                                                                                \
+            return;                                                                                      \
+        }                                                                                                \
+    } while (0)
+
+#define TEST_ASSERT_EQUAL_INT(expected, actual) TEST_ASSERT((int)(expected) == (int)(actual))
+#define TEST_ASSERT_TRUE(value) TEST_ASSERT((value) == true)
+#define TEST_ASSERT_FALSE(value) TEST_ASSERT((value) == false)
+
+enum { k_panel, k_button, k_other_button, k_overlay, k_outside };
+
+/* A 100x100 area with a panel, two buttons in it and a widget straddling the panel edge. */
+static void build_tree(ui_tree_t* tree) {
+    const SDL_FRect bounds = {0.f, 0.f, 100.f, 100.f};
+    ui_tree_begin(tree, &bounds);
+
+    const SDL_FRect panel = {20.f, 20.f, 60.f, 60.f};
+    const SDL_FRect button = {30.f, 30.f, 40.f, 10.f};
+    const SDL_FRect other_button = {30.f, 50.f, 40.f, 10.f};
+    const SDL_FRect outside = {70.f, 70.f, 25.f, 25.f};
+    ui_tree_add(tree, k_panel, UI_WIDGET_NONE, &panel);
+    ui_tree_add(tree, k_button, k_panel, &button);
+    ui_tree_add(tree, k_other_button, k_panel, &other_button);
+    ui_tree_add(tree, k_outside, k_panel, &outside);
+}
+
+static void test_hit_test_finds_topmost_widget(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    build_tree(&tree);
+
+    TEST_ASSERT_EQUAL_INT(k_button, ui_tree_hit_test(&tree, 35.f, 35.f));
+    TEST_ASSERT_EQUAL_INT(k_other_button, ui_tree_hit_test(&tree, 69.f, 59.f));
+    TEST_ASSERT_EQUAL_INT(k_panel, ui_tree_hit_test(&tree, 25.f, 45.f));
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, ui_tree_hit_test(&tree, 5.f, 5.f));
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, ui_tree_hit_test(&tree, -5.f, 150.f));
+
+    // Edges count as inside, like ui_button_contains().
+    TEST_ASSERT_EQUAL_INT(k_button, ui_tree_hit_test(&tree, 70.f, 40.f));
+}
+
+static void test_children_are_clipped_to_their_parent(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    build_tree(&tree);
+
+    TEST_ASSERT_EQUAL_INT(k_outside, ui_tree_hit_test(&tree, 75.f, 75.f));
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, ui_tree_hit_test(&tree, 90.f, 90.f));
+}
+
+static void test_get_rect_returns_added_rect(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    build_tree(&tree);
+
+    SDL_FRect rect;
+    TEST_ASSERT_TRUE(ui_tree_get_rect(&tree, k_other_button, &rect));
+    TEST_ASSERT(rect.x == 30.f && rect.y == 50.f && rect.w == 40.f && rect.h == 10.f);
+    TEST_ASSERT_FALSE(ui_tree_get_rect(&tree, k_overlay, &rect));
+}
+
+static void test_hover_changes_are_reported_once(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    build_tree(&tree);
+
+    TEST_ASSERT_TRUE(ui_tree_pointer_move(&tree, 35.f, 35.f));
+    TEST_ASSERT_EQUAL_INT(k_button, tree.hovered_id);
+    TEST_ASSERT_FALSE(ui_tree_pointer_move(&tree, 40.f, 36.f));
+    TEST_ASSERT_TRUE(ui_tree_pointer_move(&tree, 5.f, 5.f));
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, tree.hovered_id);
+}
+
+static void test_click_needs_press_and_release_on_same_widget(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    build_tree(&tree);
+
+    TEST_ASSERT_EQUAL_INT(k_button, ui_tree_pointer_down(&tree, 35.f, 35.f));
+    TEST_ASSERT_EQUAL_INT(k_button, ui_tree_pointer_up(&tree, 36.f, 36.f));
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, tree.pressed_id);
+
+    TEST_ASSERT_EQUAL_INT(k_button, ui_tree_pointer_down(&tree, 35.f, 35.f));
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, ui_tree_pointer_up(&tree, 35.f, 55.f));
+    TEST_ASSERT_EQUAL_INT(k_other_button, tree.hovered_id);
+}
+
+static void test_press_survives_relayout(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    build_tree(&tree);
+
+    TEST_ASSERT_EQUAL_INT(k_other_button, ui_tree_pointer_down(&tree, 35.f, 55.f));
+    build_tree(&tree);
+    TEST_ASSERT_EQUAL_INT(k_other_button, tree.pressed_id);
+
+    ui_tree_reset_pointer(&tree);
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, tree.pressed_id);
+    TEST_ASSERT_EQUAL_INT(UI_WIDGET_NONE, tree.hovered_id);
+}
+
+static void test_full_tree_finds_every_widget(void) {
+    ui_tree_t tree;
+    ui_tree_init(&tree);
+    const SDL_FRect bounds = {0.f, 0.f, 320.f, 320.f};
+    ui_tree_begin(&tree, &bounds);
+
+    for (int id = 0; id < UI_TREE_MAX_WIDGETS; ++id) {
+        const SDL_FRect rect = {(float)(id % 8) * 40.f, (float)(id / 8) * 40.f, 30.f, 30.f};
+        ui_tree_add(&tree, id, UI_WIDGET_NONE, &rect);
+    }
+
+    // Every widget is still found through its own cell, including the last one in the top bit.
+    for (int id = 0; id < UI_TREE_MAX_WIDGETS; ++id) {
+        const float x = (float)(id % 8) * 40.f + 15.f;
+        const float y = (float)(id / 8) * 40.f + 15.f;
+        TEST_ASSERT_EQUAL_INT(id, ui_tree_hit_test(&tree, x, y));
+    }
+}
+
+static void run_test(const char* name, test_fn_t fn) {
+    g_current_test = name;
+    const int failures_before = g_failures;
+    fn();
+    ++g_tests_run;
+    if (g_failures == failures_before) {
+        printf("[  PASSED  ] %s\n", name);
+    }
+}
+
+int main(void) {
+    printf("Running UI tree unit tests...\n");
+
+    run_test("test_hit_test_finds_topmost_widget", test_hit_test_finds_topmost_widget);
+    run_test("test_children_are_clipped_to_their_parent", test_children_are_clipped_to_their_parent);
+    run_test("test_get_rect_returns_added_rect", test_get_rect_returns_added_rect);
+    run_test("test_hover_changes_are_reported_once", test_hover_changes_are_reported_once);
+    run_test("test_click_needs_press_and_release_on_same_widget", test_click_needs_press_and_release_on_same_widget);
+    run_test("test_press_survives_relayout", test_press_survives_relayout);
+    run_test("test_full_tree_finds_every_widget", test_full_tree_finds_every_widget);
+
+    if (g_failures > 0) {
+        printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);
+        return EXIT_FAILURE;
+    }
+
+    printf("All %d UI tree tests passed.\n", g_tests_run);
+    return EXIT_SUCCESS;
+}
@@ -60,28 +60,6 @@ static void test_equals(void) {
     TEST_ASSERT_FALSE(vector2i_equals(&a, &c));
 }
 
-static void test_random_in_range(void) {
-    SDL_srand(123u);
-
-    for (int i = 0; i < 1000; ++i) {
-        vector2i_t v = {0};
-        vector2i_random(&v, 7, 9);
-        TEST_ASSERT(v.x >= 1 && v.x <= 7);
-        TEST_ASSERT(v.y >= 1 && v.y <= 9);
-    }
-}
-
-static void test_random_max_one_always_one(void) {
-    SDL_srand(999u);
-
-    for (int i = 0; i < 50; ++i) {
-        vector2i_t v = {0};
-        vector2i_random(&v, 1, 1);
-        TEST_ASSERT_EQUAL_INT(1, v.x);
-        TEST_ASSERT_EQUAL_INT(1, v.y);
-    }
-}
-
 static void run_test(const char* name, test_fn_t fn) {
     g_current_test = name;
     const int failures_before = g_failures;
@@ -99,8 +77,6 @@ int main(void) {
     run_test("test_add", test_add);
     run_test("test_subtract", test_subtract);
     run_test("test_equals", test_equals);
-    run_test("test_random_in_range", test_random_in_range);
-    run_test("test_random_max_one_always_one", test_random_max_one_always_one);
 
     if (g_failures > 0) {
         printf("%d/%d test(s) failed.\n", g_failures, g_tests_run);